@@ -0,0 +1,288 @@
+#include "graph.h"
+#include "utils.h"
+#include "axislink.h"
+#include "evalcache.h"
+#include "tilecache.h"
+#include "functions.h"
+#include "platform.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_MIN_TIME 0.2
+#define BENCH_RUNS 5
+#define BENCH_MAX_RESULTS 64
+#define BENCH_POINTS 4096
+#define BENCH_REGRESSION 1.10
+#define BENCH_LINKED_GRAPHS 10
+
+typedef struct {
+    char name[64];
+    double nsPerItem;
+} BenchResult;
+
+typedef struct {
+    const char* name;
+    FunctionPtr func;
+} BenchFunction;
+
+typedef struct {
+    const char* name;
+    float xMin, xMax;
+} BenchZoom;
+
+static BenchResult results[BENCH_MAX_RESULTS];
+static int resultCount = 0;
+static volatile float sink;
+
+typedef double (*BenchProc)(Graph* graph, void* arg);
+
+// Runs proc until BENCH_MIN_TIME has passed and keeps the best of BENCH_RUNS runs,
+// proc returns the number of items it processed
+static void RunBenchmark(const char* name, Graph* graph, BenchProc proc, void* arg) {
+    double best = INFINITY;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double items = 0;
+        double start = GetHighResTime();
+        double elapsed;
+        do {
+            items += proc(graph, arg);
+            elapsed = GetHighResTime() - start;
+        } while (elapsed < BENCH_MIN_TIME / BENCH_RUNS);
+
+        double ns = elapsed * 1e9 / items;
+        if (ns < best) best = ns;
+    }
+
+    if (resultCount < BENCH_MAX_RESULTS) {
+        BenchResult* r = &results[resultCount++];
+        snprintf(r->name, sizeof(r->name), "%s", name);
+        r->nsPerItem = best;
+    }
+    printf("%-40s %10.2f ns\n", name, best);
+}
+
+static double BenchWorldToScreen(Graph* graph, void* arg) {
+    (void)arg;
+    float x = graph->xMin, dx = (graph->xMax - graph->xMin) / BENCH_POINTS;
+    int acc = 0;
+    for (int i = 0; i < BENCH_POINTS; i++, x += dx) {
+        acc += WorldToScreenX(graph, x) + WorldToScreenY(graph, x);
+    }
+    sink = (float)acc;
+    return BENCH_POINTS;
+}
+
+static double BenchScreenToWorld(Graph* graph, void* arg) {
+    (void)arg;
+    float acc = 0;
+    for (int i = 0; i < BENCH_POINTS; i++) {
+        acc += ScreenToWorldX(graph, i) + ScreenToWorldY(graph, i);
+    }
+    sink = acc;
+    return BENCH_POINTS;
+}
+
+static double BenchOptimalStep(Graph* graph, void* arg) {
+    (void)graph;
+    (void)arg;
+    float acc = 0, range = 1e-3f;
+    for (int i = 0; i < BENCH_POINTS; i++, range *= 1.005f) {
+        acc += GetOptimalStep(range);
+    }
+    sink = acc;
+    return BENCH_POINTS;
+}
+
+// The tick work of DrawGraph without the draw calls: GetTickRange and the
+// graph's label caches, measured as on a software canvas, per tick
+static double BenchTicks(Graph* graph, void* arg) {
+    Canvas* canvas = arg;
+    int ticks = 0, acc = 0;
+
+    float xStep = GetOptimalStep(graph->xMax - graph->xMin);
+    long long xFirst, xLast;
+    for (bool ok = GetTickRange(graph->xMin, graph->xMax, xStep, &xFirst, &xLast); ok && xFirst <= xLast; xFirst++) {
+        const TickLabel* label = GetTickLabel(&graph->xTicks, canvas, xStep, xFirst);
+        acc += WorldToScreenX(graph, xFirst * xStep) - label->width / 2;
+        ticks++;
+    }
+
+    float yStep = GetOptimalStep(graph->yMax - graph->yMin);
+    long long yFirst, yLast;
+    for (bool ok = GetTickRange(graph->yMin, graph->yMax, yStep, &yFirst, &yLast); ok && yFirst <= yLast; yFirst++) {
+        const TickLabel* label = GetTickLabel(&graph->yTicks, canvas, yStep, yFirst);
+        acc += WorldToScreenY(graph, yFirst * yStep) - label->width;
+        ticks++;
+    }
+
+    sink = (float)acc;
+    return ticks;
+}
+
+static double BenchSampling(Graph* graph, void* arg) {
+    (void)arg;
+    SampleGraph(graph);
+    return graph->functions[0].sampleCount;
+}
+
+// One pan step of a linked view: graph 0 moves the shared viewport, every
+// graph then resamples; items are the samples shown across all graphs
+static double BenchLinkedPan(Graph* graph, void* arg) {
+    Graph* graphs = arg;
+    graph->xMin += 0.01f;
+    graph->xMax += 0.01f;
+    PushLinkedAxis(graph);
+
+    double samples = 0;
+    for (int i = 0; i < BENCH_LINKED_GRAPHS; i++) {
+        SampleGraph(&graphs[i]);
+        samples += graphs[i].functions[0].sampleCount;
+    }
+    return samples;
+}
+
+// Alternates between two zoom levels; after the first pass every tile is cached
+static double BenchZoomCycle(Graph* graph, void* arg) {
+    (void)arg;
+    float center = (graph->xMin + graph->xMax) / 2;
+    float half = (graph->xMax - graph->xMin) / 2;
+    half = half > 5 ? half / 2 : half * 2;
+    graph->xMin = center - half;
+    graph->xMax = center + half;
+    SampleGraph(graph);
+    return graph->functions[0].sampleCount;
+}
+
+static void RunSuite(void) {
+    Graph graph = CreateGraph((Rectangle) { 0, 0, 500, 350 });
+
+    RunBenchmark("WorldToScreenX/Y", &graph, BenchWorldToScreen, NULL);
+    RunBenchmark("ScreenToWorldX/Y", &graph, BenchScreenToWorld, NULL);
+    RunBenchmark("GetOptimalStep", &graph, BenchOptimalStep, NULL);
+    // Measuring never touches the pixels, so an empty image selects the software font
+    Image tickImage = { 0 };
+    Canvas tickCanvas = { &tickImage };
+    RunBenchmark("ticks", &graph, BenchTicks, &tickCanvas);
+
+    const BenchFunction functions[] = {
+        { "sinf", sinf }, { "tanf", tanf }, { "expFunction", expFunction }, { "logarithmic", logarithmic }
+    };
+    const BenchZoom zooms[] = {
+        { "wide", -1000, 1000 }, { "default", -10, 10 }, { "deep", 1.0f, 1.001f }
+    };
+    const int widths[] = { 500, 1920 };
+
+    char name[64];
+    for (int f = 0; f < (int)(sizeof(functions) / sizeof(functions[0])); f++) {
+        for (int w = 0; w < (int)(sizeof(widths) / sizeof(widths[0])); w++) {
+            for (int z = 0; z < (int)(sizeof(zooms) / sizeof(zooms[0])); z++) {
+                Graph g = CreateGraph((Rectangle) { 0, 0, (float)widths[w], 350 });
+                g.xMin = zooms[z].xMin;
+                g.xMax = zooms[z].xMax;
+                AddFunctionToGraph(&g, functions[f].func, BLACK);
+
+                snprintf(name, sizeof(name), "sample %s w%d %s", functions[f].name, widths[w], zooms[z].name);
+                RunBenchmark(name, &g, BenchSampling, NULL);
+                UnloadGraph(&g);
+            }
+        }
+    }
+
+    // Sampling above runs without the caches so it measures evaluation itself
+    InitTileCache(TILE_CACHE_LIMIT);
+    Graph zoom = CreateGraph((Rectangle) { 0, 0, 500, 350 });
+    AddFunctionToGraph(&zoom, sinf, BLACK);
+    RunBenchmark("tiled zoom cycle sinf", &zoom, BenchZoomCycle, NULL);
+    UnloadGraph(&zoom);
+    ShutdownTileCache();
+
+    InitEvalCache();
+    AxisLink link = CreateAxisLink(-10, 10);
+    Graph linked[BENCH_LINKED_GRAPHS];
+    for (int i = 0; i < BENCH_LINKED_GRAPHS; i++) {
+        linked[i] = CreateGraph((Rectangle) { 0, 0, 500, 350 });
+        AddFunctionToGraph(&linked[i], sinf, BLACK);
+        LinkGraphAxis(&linked[i], &link);
+    }
+    snprintf(name, sizeof(name), "linked pan sinf x%d", BENCH_LINKED_GRAPHS);
+    RunBenchmark(name, &linked[0], BenchLinkedPan, linked);
+    for (int i = 0; i < BENCH_LINKED_GRAPHS; i++) {
+        UnloadGraph(&linked[i]);
+    }
+    ShutdownEvalCache();
+
+    UnloadGraph(&graph);
+}
+
+static bool SaveBaseline(const char* fileName) {
+    FILE* file = fopen(fileName, "w");
+    if (!file) return false;
+
+    for (int i = 0; i < resultCount; i++) {
+        fprintf(file, "%.3f %s\n", results[i].nsPerItem, results[i].name);
+    }
+    return fclose(file) == 0;
+}
+
+// Returns the number of benchmarks that got slower than BENCH_REGRESSION times the baseline
+static int CompareBaseline(const char* fileName) {
+    FILE* file = fopen(fileName, "r");
+    if (!file) {
+        fprintf(stderr, "Cannot open baseline %s\n", fileName);
+        return -1;
+    }
+
+    int regressions = 0;
+    char line[128];
+    printf("\n%-40s %10s %10s %8s\n", "benchmark", "baseline", "current", "change");
+
+    while (fgets(line, sizeof(line), file)) {
+        double baseline;
+        int offset;
+        if (sscanf(line, "%lf %n", &baseline, &offset) != 1) continue;
+
+        char* name = line + offset;
+        name[strcspn(name, "\r\n")] = '\0';
+
+        for (int i = 0; i < resultCount; i++) {
+            if (strcmp(results[i].name, name) != 0) continue;
+
+            double ratio = results[i].nsPerItem / baseline;
+            bool regressed = ratio > BENCH_REGRESSION;
+            if (regressed) regressions++;
+            printf("%-40s %10.2f %10.2f %+7.1f%%%s\n", name, baseline, results[i].nsPerItem,
+                (ratio - 1) * 100, regressed ? "  SLOWER" : "");
+            break;
+        }
+    }
+
+    fclose(file);
+    return regressions;
+}
+
+// Usage: Benchmark [--save baseline.txt] [--compare baseline.txt]
+int main(int argc, char** argv) {
+    const char* saveFile = NULL;
+    const char* compareFile = NULL;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--save") == 0) saveFile = argv[i + 1];
+        else if (strcmp(argv[i], "--compare") == 0) compareFile = argv[i + 1];
+    }
+
+    printf("%-40s %10s\n", "benchmark", "per item");
+    RunSuite();
+
+    if (saveFile && !SaveBaseline(saveFile)) {
+        fprintf(stderr, "Cannot write baseline %s\n", saveFile);
+        return 1;
+    }
+    if (compareFile) {
+        int regressions = CompareBaseline(compareFile);
+        if (regressions != 0) return 1;
+    }
+    return 0;
+}
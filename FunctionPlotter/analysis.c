@@ -0,0 +1,419 @@
+#include "analysis.h"
+#include "trace.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+// f(x) - g(x), or f(x) alone when g is NULL
+typedef struct {
+    FunctionPtr f;
+    FunctionPtr g;
+} Difference;
+
+static double Evaluate(const Difference* d, double x) {
+    double y = d->f((float)x);
+    if (d->g) y -= d->g((float)x);
+    return y;
+}
+
+// Brent's zeroin: inverse quadratic or secant steps, falling back to
+// bisection whenever they would not shrink the bracket fast enough
+static double BrentRoot(const Difference* d, double a, double b, double fa, double fb, double tolerance) {
+    double c = a, fc = fa;
+    double step = b - a, previous = step;
+
+    for (int i = 0; i < ANALYSIS_MAX_ITERATIONS; i++) {
+        if (fabs(fc) < fabs(fb)) {
+            a = b; b = c; c = a;
+            fa = fb; fb = fc; fc = fa;
+        }
+        double tol = 2 * DBL_EPSILON * fabs(b) + 0.5 * tolerance;
+        double m = 0.5 * (c - b);
+        if (fabs(m) <= tol || fb == 0) break;
+
+        if (fabs(previous) < tol || fabs(fa) <= fabs(fb)) {
+            step = previous = m;
+        }
+        else {
+            double s = fb / fa, p, q;
+            if (a == c) {
+                p = 2 * m * s;
+                q = 1 - s;
+            }
+            else {
+                double r = fb / fc;
+                q = fa / fc;
+                p = s * (2 * m * q * (q - r) - (b - a) * (r - 1));
+                q = (q - 1) * (r - 1) * (s - 1);
+            }
+            if (p > 0) q = -q;
+            else p = -p;
+
+            if (2 * p < 3 * m * q - fabs(tol * q) && p < fabs(0.5 * previous * q)) {
+                previous = step;
+                step = p / q;
+            }
+            else {
+                step = previous = m;
+            }
+        }
+
+        a = b;
+        fa = fb;
+        b += fabs(step) > tol ? step : (m > 0 ? tol : -tol);
+        fb = Evaluate(d, b);
+        if ((fb > 0) == (fc > 0)) {
+            c = a;
+            fc = fa;
+            step = previous = b - a;
+        }
+    }
+    return b;
+}
+
+// Brent's minimisation of sign * f on [a, b] from x: parabolic steps through
+// the three best points, golden section when they misbehave
+static double BrentMinimum(const Difference* d, double sign, double a, double b, double x, double fx,
+    double tolerance, double* minimum) {
+    const double golden = 0.3819660112501051;
+    double w = x, v = x, fw = fx, fv = fx;
+    double step = 0, previous = 0;
+
+    for (int i = 0; i < ANALYSIS_MAX_ITERATIONS; i++) {
+        double middle = 0.5 * (a + b);
+        double tol = sqrt(DBL_EPSILON) * fabs(x) + tolerance;
+        if (fabs(x - middle) <= 2 * tol - 0.5 * (b - a)) break;
+
+        bool parabolic = false;
+        if (fabs(previous) > tol) {
+            double r = (x - w) * (fx - fv);
+            double q = (x - v) * (fx - fw);
+            double p = (x - v) * q - (x - w) * r;
+            q = 2 * (q - r);
+            if (q > 0) p = -p;
+            else q = -q;
+
+            if (fabs(p) < fabs(0.5 * q * previous) && p > q * (a - x) && p < q * (b - x)) {
+                previous = step;
+                step = p / q;
+                double u = x + step;
+                if (u - a < 2 * tol || b - u < 2 * tol) step = x < middle ? tol : -tol;
+                parabolic = true;
+            }
+        }
+        if (!parabolic) {
+            previous = x < middle ? b - x : a - x;
+            step = golden * previous;
+        }
+
+        double u = fabs(step) >= tol ? x + step : x + (step > 0 ? tol : -tol);
+        double fu = sign * Evaluate(d, u);
+
+        if (fu <= fx) {
+            if (u < x) b = x;
+            else a = x;
+            v = w; fv = fw;
+            w = x; fw = fx;
+            x = u; fx = fu;
+        }
+        else {
+            if (u < x) a = u;
+            else b = u;
+            if (fu <= fw || w == x) {
+                v = w; fv = fw;
+                w = u; fw = fu;
+            }
+            else if (fu <= fv || v == x || v == w) {
+                v = u; fv = fu;
+            }
+        }
+    }
+
+    *minimum = fx;
+    return x;
+}
+
+static bool AddFeature(AnalysisResult* result, FeatureKind kind, int function, int other, double x, double y) {
+    if (result->featureCount == ANALYSIS_MAX_FEATURES) return false;
+    result->features[result->featureCount++] = (GraphFeature){ kind, function, other, (float)x, (float)y };
+    return true;
+}
+
+static bool ReserveSamples(float** samples, int* capacity, int count) {
+    if (*capacity >= count) return true;
+    float* grown = realloc(*samples, sizeof(float) * count);
+    if (!grown) return false;
+    *samples = grown;
+    *capacity = count;
+    return true;
+}
+
+// Used for functions drawn on the GPU, whose CPU samples are not of this viewport
+static void SampleInput(AnalysisInput* input, float xMin, float xMax, int count) {
+    if (count < 2 || !ReserveSamples(&input->samples, &input->capacity, count)) return;
+    input->x0 = xMin;
+    input->step = (xMax - xMin) / (count - 1);
+    for (int i = 0; i < count; i++) {
+        input->samples[i] = input->func(input->x0 + i * input->step);
+    }
+    input->count = count;
+}
+
+// Zeros of d bracketed by sign changes of values, which sample d on the
+// input's grid. A bracket around a pole (tan) converges onto the pole, so
+// refined points no closer to zero than the bracket ends are dropped.
+static void FindSignChanges(AnalysisResult* result, const AnalysisInput* input, const float* values,
+    const Difference* d, FeatureKind kind, int function, int other, double tolerance) {
+    double last = -INFINITY;
+
+    for (int j = 0; j + 1 < input->count; j++) {
+        double y0 = values[j], y1 = values[j + 1];
+        if (!isfinite(y0) || !isfinite(y1)) continue;
+
+        double x0 = input->x0 + (double)j * input->step;
+        double x;
+        if (y0 == 0) x = x0;
+        else if ((y0 < 0) != (y1 < 0) && y1 != 0) {
+            x = BrentRoot(d, x0, x0 + input->step, y0, y1, tolerance);
+            if (fabs(Evaluate(d, x)) > fmin(fabs(y0), fabs(y1))) continue;
+        }
+        else continue;
+
+        if (x < result->xMin || x > result->xMax || x - last <= tolerance) continue;
+        last = x;
+        if (!AddFeature(result, kind, function, other, x, d->f((float)x))) return;
+    }
+}
+
+// A sample above (below) both neighbours brackets a maximum (minimum); rises
+// within float rounding of the value are noise of a flat stretch. Through a
+// smooth extremum the refined value exceeds that sample by less than its
+// larger rise over a neighbour; a far bigger one means a pole (tan).
+static void FindExtrema(AnalysisResult* result, const AnalysisInput* input, int function, double tolerance) {
+    Difference d = { input->func, NULL };
+
+    for (int j = 1; j + 1 < input->count; j++) {
+        float y0 = input->samples[j - 1], y1 = input->samples[j], y2 = input->samples[j + 1];
+        if (!isfinite(y0) || !isfinite(y1) || !isfinite(y2)) continue;
+
+        float noise = 4 * FLT_EPSILON * fabsf(y1);
+        double sign;
+        FeatureKind kind;
+        if (y1 - y0 > noise && y1 - y2 > noise) {
+            sign = -1;
+            kind = FEATURE_MAXIMUM;
+        }
+        else if (y0 - y1 > noise && y2 - y1 > noise) {
+            sign = 1;
+            kind = FEATURE_MINIMUM;
+        }
+        else continue;
+
+        double x1 = input->x0 + (double)j * input->step;
+        double minimum;
+        double x = BrentMinimum(&d, sign, x1 - input->step, x1 + input->step, x1, sign * y1, tolerance, &minimum);
+        double rise = fmax(fabs((double)y1 - y0), fabs((double)y1 - y2));
+        if (fabs(sign * minimum - y1) > rise || x < result->xMin || x > result->xMax) continue;
+        if (!AddFeature(result, kind, function, -1, x, sign * minimum)) return;
+    }
+}
+
+static void AnalyzeViewport(GraphAnalysis* analysis) {
+    AnalysisResult* result = &analysis->job;
+    double tolerance = ((double)result->xMax - result->xMin) * ANALYSIS_TOLERANCE;
+    result->featureCount = 0;
+    TraceBegin("analysis", -1, -1);
+
+    for (int i = 0; i < result->functionCount; i++) {
+        AnalysisInput* input = &analysis->inputs[i];
+        if (input->count == 0) SampleInput(input, result->xMin, result->xMax, analysis->gridCount);
+
+        Difference d = { input->func, NULL };
+        FindSignChanges(result, input, input->samples, &d, FEATURE_ROOT, i, -1, tolerance);
+        FindExtrema(result, input, i, tolerance);
+    }
+
+    // f - g on f's grid, reusing g's samples when both share it
+    for (int i = 0; i < result->functionCount; i++) {
+        const AnalysisInput* a = &analysis->inputs[i];
+        if (a->count < 2 || !ReserveSamples(&analysis->scratch, &analysis->scratchCapacity, a->count)) continue;
+
+        for (int k = i + 1; k < result->functionCount; k++) {
+            const AnalysisInput* b = &analysis->inputs[k];
+            bool shared = b->count == a->count && b->x0 == a->x0 && b->step == a->step;
+            for (int j = 0; j < a->count; j++) {
+                float other = shared ? b->samples[j] : b->func(a->x0 + j * a->step);
+                analysis->scratch[j] = a->samples[j] - other;
+            }
+
+            Difference d = { a->func, b->func };
+            FindSignChanges(result, a, analysis->scratch, &d, FEATURE_INTERSECTION, i, k, tolerance);
+        }
+    }
+
+    TraceEnd("analysis", -1, -1, result->featureCount);
+}
+
+static void AnalysisWorker(void* arg) {
+    GraphAnalysis* analysis = arg;
+    LockMutex(&analysis->mutex);
+    for (;;) {
+        while (!analysis->posted && !analysis->stopping) WaitCondition(&analysis->wake, &analysis->mutex);
+        if (analysis->stopping) break;
+        analysis->posted = false;
+        UnlockMutex(&analysis->mutex);
+
+        AnalyzeViewport(analysis);
+
+        LockMutex(&analysis->mutex);
+        AtomicStoreRelease(&analysis->finished, 1);
+        SignalCondition(&analysis->done);
+    }
+    UnlockMutex(&analysis->mutex);
+}
+
+static bool StartAnalysisWorker(GraphAnalysis* analysis) {
+    if (!InitMutex(&analysis->mutex)) return false;
+    if (InitCondition(&analysis->wake)) {
+        if (InitCondition(&analysis->done)) {
+            if (StartThread(&analysis->thread, AnalysisWorker, analysis)) return true;
+            DestroyCondition(&analysis->done);
+        }
+        DestroyCondition(&analysis->wake);
+    }
+    DestroyMutex(&analysis->mutex);
+    return false;
+}
+
+// False when no worker can be started, then the caller analyzes in place
+static bool PostJob(GraphAnalysis* analysis) {
+    if (!analysis->workerStarted) {
+        if (!StartAnalysisWorker(analysis)) return false;
+        analysis->workerStarted = true;
+    }
+
+    LockMutex(&analysis->mutex);
+    analysis->finished = 0;
+    analysis->posted = true;
+    SignalCondition(&analysis->wake);
+    UnlockMutex(&analysis->mutex);
+    return true;
+}
+
+static void WaitForJob(GraphAnalysis* analysis) {
+    LockMutex(&analysis->mutex);
+    while (!AtomicLoadAcquire(&analysis->finished)) WaitCondition(&analysis->done, &analysis->mutex);
+    UnlockMutex(&analysis->mutex);
+}
+
+static int AnalyzedFunctionCount(const Graph* graph) {
+    return graph->functionCount < ANALYSIS_MAX_FUNCTIONS ? graph->functionCount : ANALYSIS_MAX_FUNCTIONS;
+}
+
+static bool MatchesViewport(const AnalysisResult* result, const Graph* graph) {
+    if (result->xMin != graph->xMin || result->xMax != graph->xMax) return false;
+    if (result->functionCount != AnalyzedFunctionCount(graph)) return false;
+    for (int i = 0; i < result->functionCount; i++) {
+        if (result->funcs[i] != graph->functions[i].func) return false;
+    }
+    return true;
+}
+
+// Copies the grids sampled this frame so the worker never reads a Function
+static void PrepareJob(GraphAnalysis* analysis, const Graph* graph) {
+    AnalysisResult* job = &analysis->job;
+    job->xMin = graph->xMin;
+    job->xMax = graph->xMax;
+    job->functionCount = AnalyzedFunctionCount(graph);
+    analysis->gridCount = (int)graph->bounds.width + 1;
+
+    for (int i = 0; i < job->functionCount; i++) {
+        const Function* f = &graph->functions[i];
+        AnalysisInput* input = &analysis->inputs[i];
+        job->funcs[i] = f->func;
+        input->func = f->func;
+        input->count = 0;
+
+        if (f->gpu || !f->samples || f->sampleCount < 2) continue;
+        if (!ReserveSamples(&input->samples, &input->capacity, f->sampleCount)) continue;
+        memcpy(input->samples, f->samples, sizeof(float) * f->sampleCount);
+        input->count = f->sampleCount;
+        input->x0 = f->sampleX0;
+        input->step = f->sampleStep;
+    }
+}
+
+static void StoreResult(GraphAnalysis* analysis) {
+    AnalysisResult* slot = &analysis->results[analysis->nextResult];
+    *slot = analysis->job;
+    analysis->nextResult = (analysis->nextResult + 1) % ANALYSIS_CACHE_SIZE;
+    if (analysis->resultCount < ANALYSIS_CACHE_SIZE) analysis->resultCount++;
+    analysis->shown = slot;
+}
+
+void SetGraphAnalysis(Graph* graph, bool enabled) {
+    GraphAnalysis* analysis = graph->analysis;
+    if (enabled) {
+        if (!analysis) graph->analysis = calloc(1, sizeof(GraphAnalysis));
+        return;
+    }
+    if (!analysis) return;
+
+    if (analysis->workerStarted) {
+        LockMutex(&analysis->mutex);
+        analysis->stopping = true;
+        SignalCondition(&analysis->wake);
+        UnlockMutex(&analysis->mutex);
+        JoinThread(&analysis->thread);
+        DestroyCondition(&analysis->done);
+        DestroyCondition(&analysis->wake);
+        DestroyMutex(&analysis->mutex);
+    }
+    for (int i = 0; i < ANALYSIS_MAX_FUNCTIONS; i++) {
+        free(analysis->inputs[i].samples);
+    }
+    free(analysis->scratch);
+    free(analysis);
+    graph->analysis = NULL;
+}
+
+const AnalysisResult* UpdateGraphAnalysis(Graph* graph, bool wait) {
+    GraphAnalysis* analysis = graph->analysis;
+    if (!analysis) return NULL;
+
+    if (analysis->running && (wait || AtomicLoadAcquire(&analysis->finished))) {
+        WaitForJob(analysis);
+        analysis->running = false;
+        StoreResult(analysis);
+    }
+
+    for (int i = 0; i < analysis->resultCount; i++) {
+        if (MatchesViewport(&analysis->results[i], graph)) {
+            analysis->shown = &analysis->results[i];
+            return analysis->shown;
+        }
+    }
+
+    if (!analysis->running && graph->functionCount > 0 && graph->xMax > graph->xMin) {
+        PrepareJob(analysis, graph);
+        if (!wait && PostJob(analysis)) {
+            analysis->running = true;
+        }
+        else {
+            AnalyzeViewport(analysis);
+            StoreResult(analysis);
+        }
+    }
+    return analysis->shown;
+}
+
+const char* GetFeatureName(FeatureKind kind) {
+    switch (kind) {
+    case FEATURE_ROOT: return "Miejsce zerowe";
+    case FEATURE_MINIMUM: return "Minimum";
+    case FEATURE_MAXIMUM: return "Maksimum";
+    case FEATURE_INTERSECTION: return "Przeciecie";
+    }
+    return "";
+}
@@ -0,0 +1,87 @@
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#include "graph.h"
+#include "platform.h"
+
+#define ANALYSIS_MAX_FUNCTIONS 8
+#define ANALYSIS_MAX_FEATURES 256
+// Results of this many recent viewports are kept per graph
+#define ANALYSIS_CACHE_SIZE 8
+// Brent refinement stops within this fraction of the viewport width
+#define ANALYSIS_TOLERANCE 1e-7
+#define ANALYSIS_MAX_ITERATIONS 64
+#define ANALYSIS_MARKER_RADIUS 4.0f
+
+typedef enum {
+    FEATURE_ROOT,
+    FEATURE_MINIMUM,
+    FEATURE_MAXIMUM,
+    FEATURE_INTERSECTION
+} FeatureKind;
+
+typedef struct {
+    FeatureKind kind;
+    int function;   // index into graph->functions
+    int other;      // second function of an intersection, -1 otherwise
+    float x, y;
+} GraphFeature;
+
+// Features of the first functionCount functions for x in [xMin, xMax]
+typedef struct {
+    float xMin, xMax;
+    int functionCount;
+    FunctionPtr funcs[ANALYSIS_MAX_FUNCTIONS];
+    int featureCount;
+    GraphFeature features[ANALYSIS_MAX_FEATURES];
+} AnalysisResult;
+
+// samples[i] at x = x0 + i * step; count 0 makes the worker sample its own grid
+typedef struct {
+    FunctionPtr func;
+    int count;
+    float x0, step;
+    float* samples;
+    int capacity;
+} AnalysisInput;
+
+typedef struct GraphAnalysis {
+    AnalysisResult results[ANALYSIS_CACHE_SIZE];
+    int resultCount;
+    int nextResult;
+    const AnalysisResult* shown;
+
+    // Owned by the worker while running
+    AnalysisResult job;
+    AnalysisInput inputs[ANALYSIS_MAX_FUNCTIONS];
+    int gridCount;
+    float* scratch;
+    int scratchCapacity;
+
+    // One worker per graph, started with the first job: it sleeps on wake
+    // until a job is posted and signals done when the job is finished
+    Thread thread;
+    Mutex mutex;
+    Condition wake, done;
+    bool workerStarted;
+    bool posted;
+    bool stopping;
+    bool running;
+    volatile size_t finished;
+} GraphAnalysis;
+
+// Roots, local extrema and pairwise intersections of a graph's functions in
+// its viewport. Sign changes of f, of its differences and of f - g on the
+// already sampled grid bracket each feature, Brent's method refines it on a
+// worker thread, and results are cached per viewport, so drawing the
+// markers never evaluates a function. A new job is only posted once the
+// previous one is collected, so viewports passed meanwhile are skipped.
+void SetGraphAnalysis(Graph* graph, bool enabled);
+// Collects a finished job and starts one for a viewport that is not cached.
+// Returns the result for the current viewport, else the latest one (features
+// are in world space, so they stay valid while the next job runs), or NULL.
+// With wait the job runs to completion before returning.
+const AnalysisResult* UpdateGraphAnalysis(Graph* graph, bool wait);
+const char* GetFeatureName(FeatureKind kind);
+
+#endif
@@ -0,0 +1,34 @@
+#include "arena.h"
+#include <stdlib.h>
+
+#define ARENA_HEADER ((sizeof(ArenaBlock) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+void* ArenaAlloc(Arena* arena, size_t size) {
+    size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+    ArenaBlock* block = arena->blocks;
+    if (!block || block->size - block->used < size) {
+        size_t blockSize = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        block = calloc(1, ARENA_HEADER + blockSize);
+        if (!block) return NULL;
+
+        block->size = blockSize;
+        block->next = arena->blocks;
+        arena->blocks = block;
+        arena->allocated += blockSize;
+    }
+
+    void* p = (unsigned char*)block + ARENA_HEADER + block->used;
+    block->used += size;
+    return p;
+}
+
+void FreeArena(Arena* arena) {
+    ArenaBlock* block = arena->blocks;
+    while (block) {
+        ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    *arena = (Arena){ 0 };
+}
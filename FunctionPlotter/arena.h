@@ -0,0 +1,25 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+#define ARENA_BLOCK_SIZE (256 * 1024)
+#define ARENA_ALIGNMENT 16
+
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;
+    size_t used;
+} ArenaBlock;
+
+// Bump allocator over a chain of blocks; individual allocations are never
+// freed, everything goes at once in FreeArena. Returned memory is zeroed.
+typedef struct {
+    ArenaBlock* blocks;
+    size_t allocated;
+} Arena;
+
+void* ArenaAlloc(Arena* arena, size_t size);
+void FreeArena(Arena* arena);
+
+#endif
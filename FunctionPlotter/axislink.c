@@ -0,0 +1,34 @@
+#include "axislink.h"
+#include "utils.h"
+
+AxisLink CreateAxisLink(float xMin, float xMax) {
+    return (AxisLink){ .xMin = xMin, .xMax = xMax, .version = 1 };
+}
+
+void LinkGraphAxis(Graph* graph, AxisLink* link) {
+    graph->xLink = link;
+    graph->xLinkVersion = 0;
+    PullLinkedAxis(graph);
+}
+
+void PullLinkedAxis(Graph* graph) {
+    AxisLink* link = graph->xLink;
+    if (!link || graph->xLinkVersion == link->version) return;
+
+    graph->xMin = link->xMin;
+    graph->xMax = link->xMax;
+    graph->xLinkVersion = link->version;
+    UpdateGraphTransform(graph);
+}
+
+void PushLinkedAxis(Graph* graph) {
+    AxisLink* link = graph->xLink;
+    if (!link) return;
+
+    if (graph->xMin != link->xMin || graph->xMax != link->xMax) {
+        link->xMin = graph->xMin;
+        link->xMax = graph->xMax;
+        link->version++;
+    }
+    graph->xLinkVersion = link->version;
+}
@@ -0,0 +1,23 @@
+#ifndef AXISLINK_H
+#define AXISLINK_H
+
+#include "graph.h"
+
+// Shared x viewport: every graph linked to it pans and zooms together.
+// A change made by one graph bumps version and the others pull it before
+// their next update or draw. Linked graphs then sample on identical grids,
+// so the evaluation cache hands them the same samples.
+typedef struct AxisLink {
+    float xMin, xMax;
+    unsigned int version;
+} AxisLink;
+
+AxisLink CreateAxisLink(float xMin, float xMax);
+void LinkGraphAxis(Graph* graph, AxisLink* link);
+
+// Take the link's viewport if it moved since the graph last saw it
+void PullLinkedAxis(Graph* graph);
+// Publish the graph's viewport to the link if it changed it
+void PushLinkedAxis(Graph* graph);
+
+#endif
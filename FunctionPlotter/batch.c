@@ -0,0 +1,323 @@
+#include "batch.h"
+#include "functions.h"
+#include "export.h"
+#include "platform.h"
+#include "profiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BATCH_QUEUE_PER_THREAD 2
+
+typedef struct {
+    const char* name;
+    Color color;
+} NamedColor;
+
+static const NamedColor namedColors[] = {
+    { "BLACK", BLACK }, { "GRAY", GRAY }, { "DARKGRAY", DARKGRAY }, { "RED", RED },
+    { "MAROON", MAROON }, { "ORANGE", ORANGE }, { "GOLD", GOLD }, { "GREEN", GREEN },
+    { "DARKGREEN", DARKGREEN }, { "BLUE", BLUE }, { "DARKBLUE", DARKBLUE }, { "PURPLE", PURPLE },
+    { "PINK", PINK }, { "BROWN", BROWN },
+};
+
+typedef struct {
+    Image image;
+    const GraphSpec* spec;
+} RenderedGraph;
+
+typedef struct {
+    const GraphSpec* specs;
+    int specCount;
+    int nextSpec;
+    RenderedGraph* queue;
+    int queueCapacity;
+    int queueHead;
+    int queueCount;
+    int exported;
+    int failed;
+    Mutex mutex;
+} BatchState;
+
+static bool ParseColor(const char* text, Color* color) {
+    unsigned int rgb;
+    if (text[0] == '#' && strlen(text) == 7 && sscanf(text + 1, "%x", &rgb) == 1) {
+        *color = (Color){ (unsigned char)(rgb >> 16), (unsigned char)(rgb >> 8), (unsigned char)rgb, 255 };
+        return true;
+    }
+    for (size_t i = 0; i < sizeof(namedColors) / sizeof(namedColors[0]); i++) {
+        if (strcmp(namedColors[i].name, text) == 0) {
+            *color = namedColors[i].color;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void CopyText(char* dst, size_t size, const char* src) {
+    snprintf(dst, size, "%s", src);
+}
+
+// Decided while loading: raylib's string helpers share static buffers, so
+// workers must not call IsFileExtension (ExportImage included)
+static bool GetOutputFormat(const char* output, GraphOutputFormat* format) {
+    if (IsFileExtension(output, ".png")) *format = GRAPH_OUTPUT_PNG;
+    else if (IsFileExtension(output, ".svg")) *format = GRAPH_OUTPUT_SVG;
+    else if (IsFileExtension(output, ".pdf")) *format = GRAPH_OUTPUT_PDF;
+    else return false;
+    return true;
+}
+
+static GraphSpec DefaultGraphSpec(const char* output) {
+    GraphSpec spec = {
+        .width = 600, .height = 450,
+        .bounds = { 50, 50, 500, 350 },
+        .xMin = -10, .xMax = 10,
+        .yMin = -1, .yMax = 1,
+        .autoFitY = false,
+        .functionCount = 0
+    };
+    CopyText(spec.output, sizeof(spec.output), output);
+    CopyText(spec.title, sizeof(spec.title), "Wykres funkcji");
+    CopyText(spec.xLabel, sizeof(spec.xLabel), "X");
+    CopyText(spec.yLabel, sizeof(spec.yLabel), "Y");
+    return spec;
+}
+
+static bool ParseSpecLine(GraphSpec* spec, const char* key, const char* rest) {
+    char name[64], colorName[64];
+
+    if (strcmp(key, "size") == 0) return sscanf(rest, "%d %d", &spec->width, &spec->height) == 2;
+    if (strcmp(key, "bounds") == 0) {
+        return sscanf(rest, "%f %f %f %f", &spec->bounds.x, &spec->bounds.y, &spec->bounds.width, &spec->bounds.height) == 4;
+    }
+    if (strcmp(key, "x") == 0) return sscanf(rest, "%f %f", &spec->xMin, &spec->xMax) == 2;
+    if (strcmp(key, "y") == 0) {
+        spec->autoFitY = strncmp(rest, "auto", 4) == 0;
+        return spec->autoFitY || sscanf(rest, "%f %f", &spec->yMin, &spec->yMax) == 2;
+    }
+    if (strcmp(key, "title") == 0) {
+        CopyText(spec->title, sizeof(spec->title), rest);
+        return true;
+    }
+    if (strcmp(key, "xlabel") == 0) {
+        CopyText(spec->xLabel, sizeof(spec->xLabel), rest);
+        return true;
+    }
+    if (strcmp(key, "ylabel") == 0) {
+        CopyText(spec->yLabel, sizeof(spec->yLabel), rest);
+        return true;
+    }
+    if (strcmp(key, "function") == 0) {
+        int fields = sscanf(rest, "%63s %63s", name, colorName);
+        FunctionPtr func = fields >= 1 ? FindFunction(name) : NULL;
+        Color color = BLACK;
+        if (!func || spec->functionCount >= BATCH_MAX_FUNCTIONS) return false;
+        if (fields == 2 && !ParseColor(colorName, &color)) return false;
+
+        spec->functions[spec->functionCount] = func;
+        spec->colors[spec->functionCount++] = color;
+        return true;
+    }
+    return false;
+}
+
+GraphSpec* LoadGraphSpecs(const char* fileName, int* count) {
+    *count = 0;
+    char* text = LoadFileText(fileName);
+    if (!text) return NULL;
+
+    GraphSpec* specs = NULL;
+    int capacity = 0;
+    bool inGraph = false, valid = true;
+    int lineNumber = 0;
+
+    for (char* line = text; line && valid; ) {
+        char* next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+        lineNumber++;
+
+        size_t length = strlen(line);
+        while (length > 0 && (line[length - 1] == '\r' || line[length - 1] == ' ')) line[--length] = '\0';
+        while (*line == ' ' || *line == '\t') line++;
+
+        char key[16] = { 0 };
+        const char* rest = line;
+        while (*rest && *rest != ' ' && *rest != '\t') rest++;
+        size_t keyLength = (size_t)(rest - line);
+        while (*rest == ' ' || *rest == '\t') rest++;
+
+        if (*line != '\0' && *line != '#') {
+            if (keyLength < sizeof(key)) memcpy(key, line, keyLength);
+
+            if (strcmp(key, "graph") == 0 && !inGraph && *rest) {
+                if (*count == capacity) {
+                    int grownCapacity = capacity ? capacity * 2 : 64;
+                    GraphSpec* grown = realloc(specs, sizeof(GraphSpec) * grownCapacity);
+                    if (!grown) {
+                        fprintf(stderr, "%s: out of memory\n", fileName);
+                        UnloadFileText(text);
+                        free(specs);
+                        *count = 0;
+                        return NULL;
+                    }
+                    specs = grown;
+                    capacity = grownCapacity;
+                }
+                specs[(*count)++] = DefaultGraphSpec(rest);
+                inGraph = true;
+                valid = GetOutputFormat(rest, &specs[*count - 1].format);
+            }
+            else if (strcmp(key, "end") == 0 && inGraph) inGraph = false;
+            else valid = inGraph && ParseSpecLine(&specs[*count - 1], key, rest);
+        }
+
+        if (!valid) fprintf(stderr, "%s:%d: invalid spec line\n", fileName, lineNumber);
+        line = next;
+    }
+
+    UnloadFileText(text);
+    if (!valid || inGraph) {
+        if (valid) fprintf(stderr, "%s: missing 'end'\n", fileName);
+        free(specs);
+        *count = 0;
+        return NULL;
+    }
+    return specs;
+}
+
+static Graph CreateGraphFromSpec(const GraphSpec* spec) {
+    Graph graph = CreateGraph(spec->bounds);
+    graph.xMin = spec->xMin;
+    graph.xMax = spec->xMax;
+    graph.yMin = spec->yMin;
+    graph.yMax = spec->yMax;
+    graph.autoFitY = spec->autoFitY;
+    graph.title = spec->title;
+    graph.xLabel = spec->xLabel;
+    graph.yLabel = spec->yLabel;
+    for (int i = 0; i < spec->functionCount; i++) {
+        AddFunctionToGraph(&graph, spec->functions[i], spec->colors[i]);
+    }
+    return graph;
+}
+
+Image RenderGraphSpec(const GraphSpec* spec) {
+    Graph graph = CreateGraphFromSpec(spec);
+    Image image = GenImageColor(spec->width, spec->height, RAYWHITE);
+    DrawGraphToImage(&graph, &image);
+    UnloadGraph(&graph);
+    return image;
+}
+
+// Called without the mutex, returns with it held
+static void FinishGraph(BatchState* state, RenderedGraph item) {
+    int graphIndex = (int)(item.spec - state->specs);
+    TraceBegin("encode", graphIndex, -1);
+    int size = 0;
+    unsigned char* png = ExportImageToMemory(item.image, ".png", &size);
+    bool exported = png && SaveFileData(item.spec->output, png, size);
+    MemFree(png);
+    UnloadImage(item.image);
+    TraceEnd("encode", graphIndex, -1, 0);
+
+    LockMutex(&state->mutex);
+    if (exported) state->exported++;
+    else state->failed++;
+}
+
+// Every worker prefers encoding queued images over rendering new ones, so PNG
+// encoding of finished graphs overlaps rendering of the next ones
+static void BatchWorker(void* arg) {
+    BatchState* state = arg;
+    LockMutex(&state->mutex);
+
+    for (;;) {
+        if (state->queueCount > 0) {
+            RenderedGraph item = state->queue[state->queueHead];
+            state->queueHead = (state->queueHead + 1) % state->queueCapacity;
+            state->queueCount--;
+            UnlockMutex(&state->mutex);
+            FinishGraph(state, item);
+            continue;
+        }
+
+        if (state->nextSpec < state->specCount) {
+            const GraphSpec* spec = &state->specs[state->nextSpec++];
+            UnlockMutex(&state->mutex);
+            ProfilerSetGraph((int)(spec - state->specs));
+
+            if (spec->format != GRAPH_OUTPUT_PNG) {
+                Graph graph = CreateGraphFromSpec(spec);
+                bool exported = spec->format == GRAPH_OUTPUT_SVG ?
+                    ExportGraphSvg(&graph, spec->width, spec->height, spec->output) :
+                    ExportGraphPdf(&graph, spec->width, spec->height, spec->output);
+                UnloadGraph(&graph);
+
+                LockMutex(&state->mutex);
+                if (exported) state->exported++;
+                else state->failed++;
+                continue;
+            }
+
+            RenderedGraph item = { RenderGraphSpec(spec), spec };
+
+            LockMutex(&state->mutex);
+            if (state->queueCount < state->queueCapacity) {
+                state->queue[(state->queueHead + state->queueCount) % state->queueCapacity] = item;
+                state->queueCount++;
+            }
+            else {
+                UnlockMutex(&state->mutex);
+                FinishGraph(state, item);
+            }
+            continue;
+        }
+        break;
+    }
+
+    UnlockMutex(&state->mutex);
+}
+
+int RunBatchExport(const char* specFile, int threadCount) {
+    int specCount;
+    GraphSpec* specs = LoadGraphSpecs(specFile, &specCount);
+    if (!specs) return 1;
+
+    if (threadCount <= 0) threadCount = GetProcessorCount();
+    if (threadCount > specCount) threadCount = specCount;
+
+    BatchState state = {
+        .specs = specs,
+        .specCount = specCount,
+        .queueCapacity = threadCount * BATCH_QUEUE_PER_THREAD
+    };
+    state.queue = malloc(sizeof(RenderedGraph) * state.queueCapacity);
+    Thread* threads = malloc(sizeof(Thread) * threadCount);
+    if (!state.queue || !threads || !InitMutex(&state.mutex)) {
+        free(state.queue);
+        free(threads);
+        free(specs);
+        return 1;
+    }
+
+    double start = GetHighResTime();
+    int started = 0;
+    for (int i = 1; i < threadCount; i++) {
+        if (StartThread(&threads[started], BatchWorker, &state)) started++;
+    }
+    BatchWorker(&state);
+    for (int i = 0; i < started; i++) {
+        JoinThread(&threads[i]);
+    }
+    double elapsed = GetHighResTime() - start;
+
+    printf("Exported %d/%d graphs in %.3f s (%.1f graphs/s, %d threads)\n",
+        state.exported, specCount, elapsed, elapsed > 0 ? state.exported / elapsed : 0.0, started + 1);
+
+    DestroyMutex(&state.mutex);
+    free(threads);
+    free(state.queue);
+    free(specs);
+    return state.failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,43 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "graph.h"
+
+#define BATCH_MAX_FUNCTIONS 8
+
+// One graph block of a batch spec file (.svg and .pdf outputs are written as vectors,
+// the format is taken from the extension when the spec is loaded):
+//   graph <output.png|.svg|.pdf>
+//   size <width> <height>
+//   bounds <x> <y> <width> <height>
+//   x <min> <max>
+//   y <min> <max> | y auto
+//   title|xlabel|ylabel <text>
+//   function <name> [color]
+//   end
+typedef enum {
+    GRAPH_OUTPUT_PNG,
+    GRAPH_OUTPUT_SVG,
+    GRAPH_OUTPUT_PDF
+} GraphOutputFormat;
+
+typedef struct {
+    char output[256];
+    GraphOutputFormat format;
+    int width, height;
+    Rectangle bounds;
+    float xMin, xMax, yMin, yMax;
+    bool autoFitY;
+    char title[128];
+    char xLabel[32];
+    char yLabel[32];
+    int functionCount;
+    FunctionPtr functions[BATCH_MAX_FUNCTIONS];
+    Color colors[BATCH_MAX_FUNCTIONS];
+} GraphSpec;
+
+GraphSpec* LoadGraphSpecs(const char* fileName, int* count);
+Image RenderGraphSpec(const GraphSpec* spec);
+int RunBatchExport(const char* specFile, int threadCount);
+
+#endif
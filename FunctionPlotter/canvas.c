@@ -0,0 +1,282 @@
+#include "canvas.h"
+#include "canvasfont.h"
+#include "textbatch.h"
+#include "rlgl.h"
+#include <stdlib.h>
+#include <math.h>
+
+static void BlendPixel(Image* image, int x, int y, Color color, int coverage) {
+    if (x < 0 || y < 0 || x >= image->width || y >= image->height) return;
+
+    unsigned char* p = (unsigned char*)image->data + ((size_t)y * image->width + x) * 4;
+    int a = color.a * coverage / 255;
+    if (a >= 255) {
+        p[0] = color.r;
+        p[1] = color.g;
+        p[2] = color.b;
+        p[3] = 255;
+        return;
+    }
+    p[0] = (unsigned char)(p[0] + (color.r - p[0]) * a / 255);
+    p[1] = (unsigned char)(p[1] + (color.g - p[1]) * a / 255);
+    p[2] = (unsigned char)(p[2] + (color.b - p[2]) * a / 255);
+    p[3] = (unsigned char)(p[3] + (255 - p[3]) * a / 255);
+}
+
+static bool ClipLine(const Image* image, double* x0, double* y0, double* x1, double* y1) {
+    double t0 = 0, t1 = 1;
+    double dx = *x1 - *x0, dy = *y1 - *y0;
+    double p[4] = { -dx, dx, -dy, dy };
+    double q[4] = { *x0, image->width - 1 - *x0, *y0, image->height - 1 - *y0 };
+
+    for (int i = 0; i < 4; i++) {
+        if (p[i] == 0) {
+            if (q[i] < 0) return false;
+            continue;
+        }
+        double t = q[i] / p[i];
+        if (p[i] < 0 && t > t0) t0 = t;
+        if (p[i] > 0 && t < t1) t1 = t;
+        if (t0 > t1) return false;
+    }
+
+    double sx = *x0, sy = *y0;
+    *x0 = sx + t0 * dx;
+    *y0 = sy + t0 * dy;
+    *x1 = sx + t1 * dx;
+    *y1 = sy + t1 * dy;
+    return true;
+}
+
+void CanvasLine(Canvas* canvas, int startX, int startY, int endX, int endY, Color color) {
+    if (!canvas->image) {
+        DrawLine(startX, startY, endX, endY, color);
+        return;
+    }
+
+    double fx0 = startX, fy0 = startY, fx1 = endX, fy1 = endY;
+    if (!ClipLine(canvas->image, &fx0, &fy0, &fx1, &fy1)) return;
+
+    int x0 = (int)lround(fx0), y0 = (int)lround(fy0);
+    int x1 = (int)lround(fx1), y1 = (int)lround(fy1);
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    for (;;) {
+        BlendPixel(canvas->image, x0, y0, color, 255);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void PlotCoverage(Image* image, bool steep, int x, int y, double coverage, Color color) {
+    int c = (int)(coverage * 255 + 0.5);
+    if (c <= 0) return;
+    if (steep) BlendPixel(image, y, x, color, c);
+    else BlendPixel(image, x, y, color, c);
+}
+
+static double Fraction(double v) {
+    return v - floor(v);
+}
+
+// Xiaolin Wu's line; endpoints get partial coverage so joined segments blend evenly
+static void DrawWuLine(Image* image, double x0, double y0, double x1, double y1, Color color) {
+    if (!ClipLine(image, &x0, &y0, &x1, &y1)) return;
+
+    bool steep = fabs(y1 - y0) > fabs(x1 - x0);
+    double t;
+    if (steep) {
+        t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+    }
+    if (x0 > x1) {
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+
+    double dx = x1 - x0;
+    double gradient = dx == 0 ? 1 : (y1 - y0) / dx;
+
+    double xEnd = round(x0);
+    double yEnd = y0 + gradient * (xEnd - x0);
+    double gap = 1 - Fraction(x0 + 0.5);
+    int first = (int)xEnd;
+    PlotCoverage(image, steep, first, (int)floor(yEnd), (1 - Fraction(yEnd)) * gap, color);
+    PlotCoverage(image, steep, first, (int)floor(yEnd) + 1, Fraction(yEnd) * gap, color);
+    double y = yEnd + gradient;
+
+    xEnd = round(x1);
+    yEnd = y1 + gradient * (xEnd - x1);
+    gap = Fraction(x1 + 0.5);
+    int last = (int)xEnd;
+    PlotCoverage(image, steep, last, (int)floor(yEnd), (1 - Fraction(yEnd)) * gap, color);
+    PlotCoverage(image, steep, last, (int)floor(yEnd) + 1, Fraction(yEnd) * gap, color);
+
+    for (int x = first + 1; x < last; x++, y += gradient) {
+        PlotCoverage(image, steep, x, (int)floor(y), 1 - Fraction(y), color);
+        PlotCoverage(image, steep, x, (int)floor(y) + 1, Fraction(y), color);
+    }
+}
+
+static void FeatherVertex(float x, float y, Color color, unsigned char alpha) {
+    rlColor4ub(color.r, color.g, color.b, alpha);
+    rlVertex2f(x, y);
+}
+
+// Each segment is two quads fading from full alpha on the centre line to zero
+// one pixel out on either side, which integrates to a 1 px wide line. Both are
+// wound like raylib's own quads, so back-face culling keeps them.
+static void DrawFeatheredPolyline(const Vector2* points, int count, Color color) {
+    rlCheckRenderBatchLimit(8 * (count - 1));
+    rlBegin(RL_QUADS);
+
+    for (int i = 1; i < count; i++) {
+        Vector2 a = points[i - 1], b = points[i];
+        float dx = b.x - a.x, dy = b.y - a.y;
+        float length = sqrtf(dx * dx + dy * dy);
+        if (length < 1e-4f) continue;
+
+        float nx = -dy / length, ny = dx / length;
+        FeatherVertex(a.x, a.y, color, color.a);
+        FeatherVertex(b.x, b.y, color, color.a);
+        FeatherVertex(b.x - nx, b.y - ny, color, 0);
+        FeatherVertex(a.x - nx, a.y - ny, color, 0);
+
+        FeatherVertex(a.x, a.y, color, color.a);
+        FeatherVertex(a.x + nx, a.y + ny, color, 0);
+        FeatherVertex(b.x + nx, b.y + ny, color, 0);
+        FeatherVertex(b.x, b.y, color, color.a);
+    }
+
+    rlEnd();
+}
+
+void CanvasPolyline(Canvas* canvas, const Vector2* points, int count, Color color) {
+    if (count < 2) return;
+
+    if (!canvas->image) {
+        DrawFeatheredPolyline(points, count, color);
+        return;
+    }
+
+    for (int i = 1; i < count; i++) {
+        DrawWuLine(canvas->image, points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, color);
+    }
+}
+
+void CanvasRectangle(Canvas* canvas, int x, int y, int width, int height, Color color) {
+    if (!canvas->image) {
+        DrawRectangle(x, y, width, height, color);
+        return;
+    }
+
+    Image* image = canvas->image;
+    int x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+    int x1 = x + width > image->width ? image->width : x + width;
+    int y1 = y + height > image->height ? image->height : y + height;
+
+    for (int py = y0; py < y1; py++) {
+        for (int px = x0; px < x1; px++) {
+            BlendPixel(image, px, py, color, 255);
+        }
+    }
+}
+
+void CanvasRectangleLines(Canvas* canvas, Rectangle rec, float thick, Color color) {
+    if (!canvas->image) {
+        DrawRectangleLinesEx(rec, thick, color);
+        return;
+    }
+
+    int x = (int)rec.x, y = (int)rec.y, w = (int)rec.width, h = (int)rec.height, t = (int)thick;
+    CanvasRectangle(canvas, x, y, w, t, color);
+    CanvasRectangle(canvas, x, y + h - t, w, t, color);
+    CanvasRectangle(canvas, x, y + t, t, h - 2 * t, color);
+    CanvasRectangle(canvas, x + w - t, y + t, t, h - 2 * t, color);
+}
+
+void CanvasCircle(Canvas* canvas, Vector2 center, float radius, Color color) {
+    if (!canvas->image) {
+        DrawCircleV(center, radius, color);
+        return;
+    }
+
+    int r = (int)ceilf(radius);
+    for (int dy = -r; dy <= r; dy++) {
+        for (int dx = -r; dx <= r; dx++) {
+            if (dx * dx + dy * dy <= radius * radius) {
+                BlendPixel(canvas->image, (int)center.x + dx, (int)center.y + dy, color, 255);
+            }
+        }
+    }
+}
+
+static const CanvasGlyph* GetGlyph(char c) {
+    int index = (unsigned char)c - CANVAS_FONT_FIRST;
+    if (index < 0 || index >= CANVAS_FONT_GLYPHS) index = '?' - CANVAS_FONT_FIRST;
+    return &canvasFontGlyphs[index];
+}
+
+static int GlyphCoverage(const CanvasGlyph* glyph, int x, int y) {
+    if (x < 0 || y < 0 || x >= glyph->width || y >= CANVAS_FONT_HEIGHT) return 0;
+    int i = glyph->offset + y * glyph->width + x;
+    int nibble = (canvasFontPixels[i >> 1] >> ((i & 1) * 4)) & 15;
+    return nibble * 17;
+}
+
+void CanvasText(Canvas* canvas, const char* text, int x, int y, int fontSize, Color color) {
+    if (!canvas->image) {
+        if (IsTextAtlasReady()) QueueText(text, (float)x, (float)y, fontSize, color);
+        else DrawText(text, x, y, fontSize, color);
+        return;
+    }
+
+    float scale = (float)fontSize / CANVAS_FONT_HEIGHT;
+    float penX = (float)x;
+
+    for (const char* c = text; *c; c++) {
+        const CanvasGlyph* glyph = GetGlyph(*c);
+        int width = (int)ceilf(glyph->width * scale);
+
+        for (int dy = 0; dy < fontSize; dy++) {
+            float gy = (dy + 0.5f) / scale - 0.5f;
+            int y0 = (int)floorf(gy);
+            float fy = gy - y0;
+
+            for (int dx = 0; dx < width; dx++) {
+                float gx = (dx + 0.5f) / scale - 0.5f;
+                int x0 = (int)floorf(gx);
+                float fx = gx - x0;
+
+                float top = GlyphCoverage(glyph, x0, y0) * (1 - fx) + GlyphCoverage(glyph, x0 + 1, y0) * fx;
+                float bottom = GlyphCoverage(glyph, x0, y0 + 1) * (1 - fx) + GlyphCoverage(glyph, x0 + 1, y0 + 1) * fx;
+                int coverage = (int)(top * (1 - fy) + bottom * fy);
+                if (coverage > 0) BlendPixel(canvas->image, (int)penX + dx, y + dy, color, coverage);
+            }
+        }
+        penX += glyph->advance * scale;
+    }
+}
+
+int CanvasMeasureText(Canvas* canvas, const char* text, int fontSize) {
+    if (!canvas->image && !IsTextAtlasReady()) return MeasureText(text, fontSize);
+    return MeasureSoftwareText(text, fontSize);
+}
+
+int MeasureSoftwareText(const char* text, int fontSize) {
+    float width = 0;
+    for (const char* c = text; *c; c++) {
+        width += GetGlyph(*c)->advance;
+    }
+    return (int)ceilf(width * fontSize / CANVAS_FONT_HEIGHT);
+}
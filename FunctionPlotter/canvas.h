@@ -0,0 +1,24 @@
+#ifndef CANVAS_H
+#define CANVAS_H
+
+#include "raylib.h"
+
+// Drawing target: the raylib window when image is NULL, otherwise a CPU-side
+// R8G8B8A8 image rasterized in software so no window or GPU is needed.
+// Window text is queued into the text batch once its atlas is loaded.
+typedef struct {
+    Image* image;
+} Canvas;
+
+void CanvasLine(Canvas* canvas, int startX, int startY, int endX, int endY, Color color);
+// Anti-aliased 1 px polyline through sub-pixel points: feathered quads in the
+// window, Wu lines in images
+void CanvasPolyline(Canvas* canvas, const Vector2* points, int count, Color color);
+void CanvasRectangle(Canvas* canvas, int x, int y, int width, int height, Color color);
+void CanvasRectangleLines(Canvas* canvas, Rectangle rec, float thick, Color color);
+void CanvasCircle(Canvas* canvas, Vector2 center, float radius, Color color);
+void CanvasText(Canvas* canvas, const char* text, int x, int y, int fontSize, Color color);
+int CanvasMeasureText(Canvas* canvas, const char* text, int fontSize);
+int MeasureSoftwareText(const char* text, int fontSize);
+
+#endif
@@ -0,0 +1,448 @@
+// Glyphs rasterized from DejaVu Sans, a derivative of Bitstream Vera:
+//
+// Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved. Bitstream Vera is
+// a trademark of Bitstream, Inc. DejaVu changes are in the public domain.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of the fonts accompanying this license ("Fonts") and associated
+// documentation files (the "Font Software"), to reproduce and distribute the
+// Font Software, including without limitation the rights to use, copy, merge,
+// publish, distribute, and/or sell copies of the Font Software, and to permit
+// persons to whom the Font Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright and trademark notices and this permission notice shall
+// be included in all copies of one or more of the Font Software typefaces.
+//
+// The Font Software may be modified, altered, or added to, and in particular
+// the designs of glyphs or characters in the Fonts may be modified and
+// additional glyphs or characters may be added to the Fonts, only if the fonts
+// are renamed to names not containing either the words "Bitstream" or the word
+// "Vera".
+//
+// This License becomes null and void to the extent applicable to Fonts or Font
+// Software that has been modified and is distributed under the "Bitstream
+// Vera" names.
+//
+// The Font Software may be sold as part of a larger software package but no
+// copy of one or more of the Font Software typefaces may be sold by itself.
+//
+// THE FONT SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO ANY WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT OF COPYRIGHT, PATENT,
+// TRADEMARK, OR OTHER RIGHT. IN NO EVENT SHALL BITSTREAM OR THE GNOME
+// FOUNDATION BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, INCLUDING
+// ANY GENERAL, SPECIAL, INDIRECT, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+// THE USE OR INABILITY TO USE THE FONT SOFTWARE OR FROM OTHER DEALINGS IN THE
+// FONT SOFTWARE.
+//
+// Except as contained in this notice, the names of Gnome, the Gnome
+// Foundation, and Bitstream Inc., shall not be used in advertising or
+// otherwise to promote the sale, use or other dealings in this Font Software
+// without prior written authorization from the Gnome Foundation or Bitstream
+// Inc., respectively. For further information, contact: fonts at gnome dot
+// org.
+
+#include "canvasfont.h"
+
+// DejaVu Sans rendered at 13px into 16px cells, 4-bit coverage packed two pixels per byte (low nibble first)
+const CanvasGlyph canvasFontGlyphs[CANVAS_FONT_GLYPHS] = {
+    { 0, 4, 4 }, { 64, 5, 5 }, { 144, 6, 6 }, { 240, 11, 11 },
+    { 416, 8, 8 }, { 544, 12, 12 }, { 736, 10, 10 }, { 896, 4, 4 },
+    { 960, 5, 5 }, { 1040, 5, 5 }, { 1120, 7, 7 }, { 1232, 11, 11 },
+    { 1408, 4, 4 }, { 1472, 5, 5 }, { 1552, 4, 4 }, { 1616, 5, 4 },
+    { 1696, 8, 8 }, { 1824, 8, 8 }, { 1952, 8, 8 }, { 2080, 8, 8 },
+    { 2208, 8, 8 }, { 2336, 8, 8 }, { 2464, 8, 8 }, { 2592, 8, 8 },
+    { 2720, 8, 8 }, { 2848, 8, 8 }, { 2976, 4, 4 }, { 3040, 4, 4 },
+    { 3104, 11, 11 }, { 3280, 11, 11 }, { 3456, 11, 11 }, { 3632, 7, 7 },
+    { 3744, 13, 13 }, { 3952, 9, 9 }, { 4096, 9, 9 }, { 4240, 9, 9 },
+    { 4384, 10, 10 }, { 4544, 8, 8 }, { 4672, 7, 7 }, { 4784, 10, 10 },
+    { 4944, 10, 10 }, { 5104, 4, 4 }, { 5168, 4, 4 }, { 5232, 9, 9 },
+    { 5376, 8, 7 }, { 5504, 11, 11 }, { 5680, 10, 10 }, { 5840, 10, 10 },
+    { 6000, 8, 8 }, { 6128, 10, 10 }, { 6288, 9, 9 }, { 6432, 8, 8 },
+    { 6560, 8, 8 }, { 6688, 10, 10 }, { 6848, 9, 9 }, { 6992, 13, 13 },
+    { 7200, 9, 9 }, { 7344, 8, 8 }, { 7472, 9, 9 }, { 7616, 5, 5 },
+    { 7696, 5, 4 }, { 7776, 5, 5 }, { 7856, 11, 11 }, { 8032, 7, 7 },
+    { 8144, 7, 7 }, { 8256, 8, 8 }, { 8384, 8, 8 }, { 8512, 7, 7 },
+    { 8624, 8, 8 }, { 8752, 8, 8 }, { 8880, 5, 5 }, { 8960, 8, 8 },
+    { 9088, 8, 8 }, { 9216, 4, 4 }, { 9280, 4, 4 }, { 9344, 8, 8 },
+    { 9472, 4, 4 }, { 9536, 13, 13 }, { 9744, 8, 8 }, { 9872, 8, 8 },
+    { 10000, 8, 8 }, { 10128, 8, 8 }, { 10256, 6, 5 }, { 10352, 7, 7 },
+    { 10464, 5, 5 }, { 10544, 8, 8 }, { 10672, 8, 8 }, { 10800, 11, 11 },
+    { 10976, 8, 8 }, { 11104, 8, 8 }, { 11232, 7, 7 }, { 11344, 8, 8 },
+    { 11472, 4, 4 }, { 11536, 8, 8 }, { 11664, 11, 11 }
+};
+
+const unsigned char canvasFontPixels[5920] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0xf0, 0x04, 0x00,
+    0x4f, 0x00, 0xf0, 0x04, 0x00, 0x3f, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x4f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x55, 0x0b, 0xb0, 0x55, 0x0b, 0xb0, 0x55, 0x0b, 0xb0, 0x55, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x09, 0x79, 0x00, 0x00, 0x00,
+    0x5a, 0xc0, 0x04, 0x00, 0x00, 0xd0, 0x02, 0x1e, 0x00, 0x40, 0xff, 0xff, 0xff, 0xdf, 0x00, 0x00,
+    0xa6, 0x70, 0x08, 0x00, 0x00, 0xa0, 0x06, 0x4b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00,
+    0xe2, 0x40, 0x0c, 0x00, 0x00, 0x50, 0x0a, 0x97, 0x00, 0x00, 0x00, 0x78, 0xa0, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x06, 0x00, 0x20, 0xeb, 0xae, 0x02, 0xb0, 0x5a, 0x57, 0x07, 0xd0, 0x45, 0x06, 0x00,
+    0x60, 0xad, 0x19, 0x00, 0x00, 0x71, 0xdb, 0x08, 0x00, 0x40, 0x16, 0x2f, 0xa0, 0x44, 0x66, 0x1e,
+    0x30, 0xeb, 0xbe, 0x04, 0x00, 0x40, 0x06, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xde, 0x04, 0x00, 0x5a, 0x00, 0xe2, 0x42,
+    0x0e, 0x50, 0x0a, 0x00, 0xb4, 0x00, 0x1e, 0xd1, 0x01, 0x00, 0xe2, 0x42, 0x0e, 0x5a, 0x00, 0x00,
+    0x70, 0xde, 0x54, 0x1a, 0xeb, 0x1a, 0x00, 0x00, 0xd1, 0x81, 0x19, 0x7a, 0x00, 0x00, 0x5a, 0xb0,
+    0x04, 0x96, 0x00, 0x50, 0x0b, 0x80, 0x19, 0x7a, 0x00, 0xd1, 0x02, 0x10, 0xeb, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xae, 0x02, 0x00, 0x00, 0x7e, 0x41, 0x07, 0x00, 0x10, 0x4f,
+    0x00, 0x00, 0x00, 0x00, 0xdb, 0x02, 0x00, 0x00, 0x80, 0x5a, 0x3e, 0x00, 0x2f, 0xf1, 0x02, 0xe5,
+    0x44, 0x0d, 0xf2, 0x03, 0x40, 0xde, 0x06, 0xb0, 0x3c, 0x31, 0xfc, 0x05, 0x10, 0xd9, 0xcf, 0x46,
+    0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x05, 0xb0, 0x05, 0xb0, 0x05, 0xb0, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0xc0, 0x05, 0x30, 0x0e, 0x00, 0xa8, 0x00, 0xb0,
+    0x07, 0x00, 0x6d, 0x00, 0xd0, 0x06, 0x00, 0x7b, 0x00, 0x80, 0x0a, 0x00, 0xe3, 0x00, 0x00, 0x5c,
+    0x00, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x05, 0x00,
+    0xd4, 0x00, 0x00, 0x4d, 0x00, 0x90, 0x09, 0x00, 0xc6, 0x00, 0x50, 0x0e, 0x00, 0xe5, 0x00, 0x60,
+    0x0c, 0x00, 0x99, 0x00, 0xd0, 0x04, 0x40, 0x0d, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
+    0x00, 0x60, 0x28, 0x39, 0x0a, 0x50, 0xdb, 0x19, 0x00, 0xb5, 0x9d, 0x01, 0x86, 0x92, 0xb3, 0x00,
+    0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf1, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x0f, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0d, 0x90, 0x09, 0xd0, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0b,
+    0x90, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0x03, 0x20, 0x0e, 0x00, 0x97, 0x00, 0xb0, 0x05, 0x10, 0x1e, 0x00, 0xb5,
+    0x00, 0xa0, 0x06, 0x00, 0x2e, 0x00, 0xc4, 0x00, 0x80, 0x08, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe8, 0xae, 0x01, 0x70, 0x3d, 0xb1, 0x0b, 0xd0, 0x06, 0x20, 0x2f, 0xf1, 0x03, 0x00, 0x5e,
+    0xf2, 0x02, 0x00, 0x6d, 0xf1, 0x03, 0x00, 0x5e, 0xd0, 0x06, 0x20, 0x2f, 0x70, 0x3d, 0xb1, 0x0b,
+    0x00, 0xe8, 0xae, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xff, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00,
+    0x00, 0x40, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00,
+    0x60, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xeb, 0x9d, 0x01, 0xb0, 0x14, 0xc3, 0x09, 0x00, 0x00, 0x70, 0x0d, 0x00, 0x00, 0xa0, 0x0a,
+    0x00, 0x00, 0xe6, 0x02, 0x00, 0x60, 0x3e, 0x00, 0x00, 0xe7, 0x03, 0x00, 0x80, 0x2d, 0x00, 0x00,
+    0xf1, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xea, 0xae, 0x02, 0x80, 0x15, 0xb2, 0x0b, 0x00, 0x00, 0x50, 0x0f, 0x00, 0x00, 0xa2, 0x0a,
+    0x00, 0xf6, 0xcf, 0x02, 0x00, 0x00, 0x91, 0x1d, 0x00, 0x00, 0x20, 0x3f, 0xa0, 0x03, 0x92, 0x0e,
+    0x50, 0xec, 0xae, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfb, 0x03, 0x00, 0x70, 0xfb, 0x03, 0x00, 0xd2, 0xf2, 0x03, 0x00, 0x5c, 0xf1, 0x03,
+    0x70, 0x0a, 0xf1, 0x03, 0xd2, 0x01, 0xf1, 0x03, 0xf5, 0xff, 0xff, 0x8f, 0x00, 0x00, 0xf1, 0x03,
+    0x00, 0x00, 0xf1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xff, 0xff, 0x07, 0x90, 0x09, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x90, 0xfe, 0x9d, 0x01,
+    0x00, 0x00, 0xc3, 0x0a, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00, 0x40, 0x1f, 0xa0, 0x13, 0xc3, 0x0b,
+    0x40, 0xec, 0x9d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc4, 0xce, 0x04, 0x30, 0x6e, 0x21, 0x09, 0xb0, 0x09, 0x00, 0x00, 0xf0, 0xc7, 0xce, 0x04,
+    0xf1, 0x3d, 0x71, 0x2e, 0xf1, 0x08, 0x00, 0x6e, 0xd0, 0x08, 0x00, 0x5e, 0x60, 0x3d, 0x71, 0x1e,
+    0x00, 0xe7, 0xce, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x90, 0x0b, 0x00, 0x00, 0xe1, 0x05, 0x00, 0x00, 0xe6, 0x00,
+    0x00, 0x00, 0x8c, 0x00, 0x00, 0x30, 0x2f, 0x00, 0x00, 0x90, 0x0b, 0x00, 0x00, 0xe1, 0x05, 0x00,
+    0x00, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xea, 0xbe, 0x03, 0xa0, 0x2c, 0x91, 0x0e, 0xd0, 0x06, 0x20, 0x2f, 0x80, 0x2b, 0x81, 0x0c,
+    0x10, 0xfb, 0xdf, 0x02, 0xc0, 0x1a, 0x71, 0x2e, 0xf1, 0x03, 0x00, 0x5e, 0xd0, 0x1a, 0x61, 0x2f,
+    0x30, 0xeb, 0xce, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xea, 0xae, 0x01, 0xc0, 0x1b, 0xb2, 0x0a, 0xf2, 0x03, 0x30, 0x2f, 0xf2, 0x03, 0x30, 0x4f,
+    0xc0, 0x1b, 0xb2, 0x5f, 0x20, 0xea, 0x7e, 0x4f, 0x00, 0x00, 0x50, 0x1e, 0x70, 0x14, 0xd4, 0x07,
+    0x20, 0xeb, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0d, 0x70, 0x0d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0d, 0x70, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0d, 0x70, 0x0d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0d, 0x90, 0x09, 0xd0, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94,
+    0x07, 0x00, 0x00, 0x83, 0xdd, 0x28, 0x00, 0x71, 0xec, 0x49, 0x00, 0x00, 0x90, 0x9f, 0x01, 0x00,
+    0x00, 0x00, 0x71, 0xec, 0x49, 0x00, 0x00, 0x00, 0x00, 0x83, 0xdd, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x94, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9,
+    0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00,
+    0x00, 0x30, 0xe8, 0x7d, 0x02, 0x00, 0x00, 0x00, 0x40, 0xea, 0x6b, 0x01, 0x00, 0x00, 0x00, 0xa1,
+    0x8f, 0x00, 0x00, 0x40, 0xe9, 0x6c, 0x01, 0x20, 0xe8, 0x7d, 0x02, 0x00, 0x00, 0x98, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xec, 0x3c, 0x10, 0x2a, 0x91, 0x0d, 0x00, 0x00, 0xd7,
+    0x00, 0x00, 0xe5, 0x04, 0x00, 0xe4, 0x02, 0x00, 0x70, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x0c, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xd9, 0xef, 0x4b, 0x00,
+    0x00, 0x50, 0x8d, 0x12, 0x51, 0x9c, 0x00, 0x30, 0x2d, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x4b, 0x40,
+    0xed, 0xba, 0x13, 0x0d, 0xd1, 0x00, 0x5e, 0x41, 0x3f, 0xd0, 0x21, 0x0c, 0xd2, 0x00, 0xd0, 0x13,
+    0x0e, 0xd1, 0x00, 0x5e, 0x40, 0x4f, 0x8a, 0x00, 0x4b, 0x40, 0xed, 0xba, 0x6c, 0x00, 0x40, 0x2d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7d, 0x02, 0x62, 0x1c, 0x00, 0x00, 0x30, 0xd9, 0xdf, 0x5b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x00, 0x00, 0x00,
+    0x9d, 0x0c, 0x00, 0x00, 0xc4, 0xe0, 0x03, 0x00, 0xa0, 0x05, 0x97, 0x00, 0x20, 0x0d, 0x10, 0x1d,
+    0x00, 0xf7, 0xff, 0xff, 0x06, 0xd0, 0x02, 0x00, 0xc4, 0x40, 0x0d, 0x00, 0x00, 0x3e, 0x9a, 0x00,
+    0x00, 0xa0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xb0, 0xff, 0xdf, 0x08, 0x00, 0x8b, 0x00, 0xe3, 0x06, 0xb0, 0x08, 0x00, 0x9b, 0x00,
+    0x8b, 0x00, 0xe3, 0x05, 0xb0, 0xff, 0xff, 0x0a, 0x00, 0x8b, 0x00, 0xb2, 0x0a, 0xb0, 0x08, 0x00,
+    0xe6, 0x00, 0x8b, 0x00, 0xb2, 0x0c, 0xb0, 0xff, 0xef, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xee, 0x7c, 0x01, 0xf4,
+    0x28, 0x31, 0x58, 0xd0, 0x09, 0x00, 0x00, 0x20, 0x3f, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
+    0x20, 0x3f, 0x00, 0x00, 0x00, 0xd0, 0x09, 0x00, 0x00, 0x00, 0xf4, 0x28, 0x31, 0x58, 0x00, 0xa3,
+    0xee, 0x7c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xdf, 0x3a, 0x00, 0xb0, 0x08, 0x20, 0xf8, 0x05, 0xb0, 0x08,
+    0x00, 0x90, 0x0d, 0xb0, 0x08, 0x00, 0x40, 0x2f, 0xb0, 0x08, 0x00, 0x20, 0x3f, 0xb0, 0x08, 0x00,
+    0x40, 0x2f, 0xb0, 0x08, 0x00, 0x90, 0x0d, 0xb0, 0x08, 0x20, 0xf8, 0x05, 0xb0, 0xff, 0xdf, 0x3a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0xff, 0xff, 0x4f, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00,
+    0xb0, 0xff, 0xff, 0x1f, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00,
+    0xb0, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff,
+    0xff, 0x0b, 0x8b, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0x8b, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x05,
+    0x8b, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0x8b, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xfe, 0x9d,
+    0x02, 0x40, 0x8f, 0x12, 0x62, 0x09, 0xd0, 0x09, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x00, 0x00, 0x00,
+    0xf4, 0x02, 0x50, 0xff, 0x0f, 0xf2, 0x03, 0x00, 0x40, 0x0f, 0xd0, 0x09, 0x00, 0x40, 0x0f, 0x40,
+    0x8f, 0x02, 0x81, 0x0f, 0x00, 0xa3, 0xfe, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x08, 0x00, 0xc0,
+    0x08, 0xb0, 0x08, 0x00, 0xc0, 0x08, 0xb0, 0x08, 0x00, 0xc0, 0x08, 0xb0, 0x08, 0x00, 0xc0, 0x08,
+    0xb0, 0xff, 0xff, 0xff, 0x08, 0xb0, 0x08, 0x00, 0xc0, 0x08, 0xb0, 0x08, 0x00, 0xc0, 0x08, 0xb0,
+    0x08, 0x00, 0xc0, 0x08, 0xb0, 0x08, 0x00, 0xc0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08,
+    0xb0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08, 0xb0, 0x08,
+    0xb0, 0x08, 0xc0, 0x07, 0xf3, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x08, 0x10, 0xcb, 0x01, 0x8b,
+    0x10, 0xbc, 0x01, 0xb0, 0x28, 0xad, 0x00, 0x00, 0xbb, 0x8e, 0x00, 0x00, 0xb0, 0xee, 0x03, 0x00,
+    0x00, 0x9b, 0xe8, 0x03, 0x00, 0xb0, 0x08, 0xe8, 0x03, 0x00, 0x8b, 0x00, 0xe7, 0x04, 0xb0, 0x08,
+    0x00, 0xe6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00,
+    0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00,
+    0xb0, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6f, 0x00, 0x30, 0xef, 0x00, 0xcb, 0x0c, 0x00, 0xc9,
+    0x0e, 0xb0, 0xd8, 0x03, 0xe1, 0xe6, 0x00, 0x8b, 0x97, 0x60, 0x4a, 0x0e, 0xb0, 0x18, 0x1e, 0x4c,
+    0xe4, 0x00, 0x8b, 0xa0, 0xda, 0x40, 0x0e, 0xb0, 0x08, 0xf4, 0x07, 0xe4, 0x00, 0x8b, 0x00, 0x00,
+    0x40, 0x0e, 0xb0, 0x08, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x4f, 0x00, 0xc0,
+    0x07, 0xb0, 0xce, 0x00, 0xc0, 0x07, 0xb0, 0xd8, 0x06, 0xc0, 0x07, 0xb0, 0x58, 0x1e, 0xc0, 0x07,
+    0xb0, 0x08, 0x8c, 0xc0, 0x07, 0xb0, 0x08, 0xe4, 0xc2, 0x07, 0xb0, 0x08, 0xa0, 0xc9, 0x07, 0xb0,
+    0x08, 0x20, 0xef, 0x07, 0xb0, 0x08, 0x00, 0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xfe, 0x5c,
+    0x00, 0x40, 0x8f, 0x12, 0xe6, 0x07, 0xd0, 0x09, 0x00, 0x50, 0x2f, 0xf2, 0x03, 0x00, 0x00, 0x6f,
+    0xf4, 0x02, 0x00, 0x00, 0x7d, 0xf2, 0x03, 0x00, 0x00, 0x6f, 0xd0, 0x09, 0x00, 0x50, 0x2f, 0x50,
+    0x8f, 0x12, 0xe5, 0x08, 0x00, 0xb4, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xce, 0x04, 0xb0, 0x08, 0x91, 0x1e,
+    0xb0, 0x08, 0x10, 0x5f, 0xb0, 0x08, 0x10, 0x5f, 0xb0, 0x08, 0x91, 0x1e, 0xb0, 0xff, 0xce, 0x04,
+    0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xfe, 0x6c,
+    0x00, 0x40, 0x8f, 0x12, 0xe6, 0x08, 0xd0, 0x09, 0x00, 0x50, 0x2f, 0xf2, 0x03, 0x00, 0x00, 0x6f,
+    0xf4, 0x02, 0x00, 0x00, 0x7d, 0xf2, 0x03, 0x00, 0x00, 0x6f, 0xd0, 0x09, 0x00, 0x50, 0x1f, 0x40,
+    0x8f, 0x12, 0xe5, 0x07, 0x00, 0xb4, 0xfe, 0x5f, 0x00, 0x00, 0x00, 0x10, 0x8e, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xce, 0x05, 0x00, 0x8b,
+    0x10, 0xf6, 0x03, 0xb0, 0x08, 0x00, 0x5f, 0x00, 0x8b, 0x10, 0xf6, 0x02, 0xb0, 0xff, 0xff, 0x04,
+    0x00, 0x8b, 0x10, 0xca, 0x00, 0xb0, 0x08, 0x10, 0x6e, 0x00, 0x8b, 0x00, 0x70, 0x0d, 0xb0, 0x08,
+    0x00, 0xe1, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xea, 0xbe, 0x04, 0xd0, 0x2a, 0x41, 0x0b, 0xf1, 0x03, 0x00, 0x00, 0xd0, 0x3a, 0x00, 0x00,
+    0x20, 0xd9, 0xcf, 0x05, 0x00, 0x00, 0x61, 0x4f, 0x00, 0x00, 0x00, 0x7d, 0xb2, 0x14, 0x61, 0x4f,
+    0x40, 0xeb, 0xce, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0xa0, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00,
+    0x00, 0xa0, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00,
+    0x00, 0xa0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0xe0, 0x06, 0xd0, 0x06, 0x00, 0xe0, 0x06, 0xd0, 0x06,
+    0x00, 0xe0, 0x06, 0xd0, 0x06, 0x00, 0xe0, 0x06, 0xd0, 0x06, 0x00, 0xe0, 0x06, 0xd0, 0x07, 0x00,
+    0xe0, 0x06, 0xb0, 0x09, 0x00, 0xf1, 0x04, 0x50, 0x5e, 0x21, 0xca, 0x00, 0x00, 0xc6, 0xee, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xaa, 0x00, 0x00, 0xb0, 0x49, 0x1e, 0x00, 0x20, 0x3f, 0xd0, 0x06, 0x00, 0xc8, 0x00,
+    0xc7, 0x00, 0xe0, 0x06, 0x20, 0x3f, 0x50, 0x1e, 0x00, 0xa0, 0x09, 0x9b, 0x00, 0x00, 0xe4, 0xf3,
+    0x03, 0x00, 0x00, 0xdd, 0x0c, 0x00, 0x00, 0x70, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xd7, 0x00, 0x60, 0x4f, 0x00, 0xf1, 0x34, 0x2f, 0x00, 0xca, 0x08, 0x40, 0x1f, 0xe0,
+    0x06, 0xe0, 0xc5, 0x00, 0xb8, 0x00, 0xaa, 0x30, 0x0d, 0x1e, 0xc0, 0x07, 0x60, 0x0e, 0x97, 0xb0,
+    0x15, 0x3f, 0x00, 0xf2, 0xb2, 0x05, 0x97, 0xe5, 0x00, 0x00, 0x7d, 0x1e, 0x30, 0x9d, 0x0b, 0x00,
+    0x90, 0xce, 0x00, 0xe0, 0x7e, 0x00, 0x00, 0xf5, 0x08, 0x00, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x08, 0x00, 0xd7, 0x01, 0xe3, 0x04, 0xe3, 0x03, 0x00, 0xd7, 0xd2, 0x07, 0x00,
+    0x00, 0xeb, 0x0b, 0x00, 0x00, 0x60, 0x6f, 0x00, 0x00, 0x20, 0x9e, 0x2e, 0x00, 0x00, 0x9c, 0x90,
+    0x0b, 0x00, 0xc8, 0x01, 0xd1, 0x07, 0xe4, 0x03, 0x00, 0xe4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x9b, 0xd1, 0x06, 0x70, 0x1d,
+    0x40, 0x2e, 0xe3, 0x03, 0x00, 0xc8, 0x7d, 0x00, 0x00, 0xd0, 0x0c, 0x00, 0x00, 0xa0, 0x09, 0x00,
+    0x00, 0xa0, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x03, 0x00,
+    0x00, 0xc1, 0x0a, 0x00, 0x00, 0xa0, 0x1c, 0x00, 0x00, 0x80, 0x2d, 0x00, 0x00, 0x60, 0x3e, 0x00,
+    0x00, 0x40, 0x5f, 0x00, 0x00, 0x20, 0x7e, 0x00, 0x00, 0x10, 0x9d, 0x00, 0x00, 0x00, 0xf6, 0xff,
+    0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x0c, 0xd0, 0x04, 0x00, 0x4d, 0x00, 0xd0,
+    0x04, 0x00, 0x4d, 0x00, 0xd0, 0x04, 0x00, 0x4d, 0x00, 0xd0, 0x04, 0x00, 0x4d, 0x00, 0xd0, 0x04,
+    0x00, 0x4d, 0x00, 0xd0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3d, 0x00, 0x80, 0x08, 0x00, 0xc4, 0x00, 0x00, 0x2e, 0x00, 0xa0, 0x06, 0x00, 0xb5,
+    0x00, 0x10, 0x1e, 0x00, 0xb0, 0x05, 0x00, 0x97, 0x00, 0x20, 0x0e, 0x00, 0xd0, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x0e, 0x00, 0xe3, 0x00, 0x30, 0x0e, 0x00,
+    0xe3, 0x00, 0x30, 0x0e, 0x00, 0xe3, 0x00, 0x30, 0x0e, 0x00, 0xe3, 0x00, 0x30, 0x0e, 0x00, 0xe3,
+    0x00, 0x30, 0x0e, 0xb0, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf9, 0x07, 0x00, 0x00, 0x00, 0xe7, 0xe6, 0x05, 0x00, 0x00, 0xe5, 0x03, 0xe4, 0x04, 0x00, 0xe3,
+    0x03, 0x00, 0xe4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x7d, 0x00, 0x00, 0x00, 0xd3, 0x05,
+    0x00, 0x00, 0x60, 0x0a, 0x50, 0xec, 0xff, 0x0c, 0xf1, 0x15, 0x70, 0x0c, 0xf2, 0x04, 0xd3, 0x0c,
+    0x70, 0xfe, 0x8c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00,
+    0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xc0, 0xb8, 0xce, 0x03, 0xc0, 0x4e, 0x71, 0x1e,
+    0xc0, 0x08, 0x00, 0x6d, 0xc0, 0x06, 0x00, 0x8b, 0xc0, 0x08, 0x00, 0x6d, 0xc0, 0x4e, 0x71, 0x1e,
+    0xc0, 0xc8, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd9, 0x9e, 0x01, 0xba, 0x12, 0x46, 0xf2, 0x02, 0x00, 0x40,
+    0x0f, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xbb, 0x12, 0x46, 0x10, 0xd9, 0x9e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x10, 0x1f,
+    0x10, 0xeb, 0x6d, 0x1f, 0xb0, 0x1a, 0xc2, 0x1f, 0xf2, 0x01, 0x40, 0x1f, 0xe4, 0x00, 0x20, 0x1f,
+    0xf2, 0x01, 0x40, 0x1f, 0xc0, 0x1a, 0xc2, 0x1f, 0x20, 0xeb, 0x6d, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xd9, 0xbe, 0x02, 0xa0, 0x2b, 0x81, 0x0c, 0xf2, 0x02, 0x00, 0x3e, 0xf4, 0xff, 0xff, 0x5f,
+    0xf2, 0x01, 0x00, 0x00, 0xa0, 0x2b, 0x31, 0x0a, 0x10, 0xd8, 0xce, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0c,
+    0xd5, 0x01, 0x80, 0x09, 0x00, 0x99, 0x00, 0xfb, 0xff, 0x08, 0x99, 0x00, 0x90, 0x09, 0x00, 0x99,
+    0x00, 0x90, 0x09, 0x00, 0x99, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xeb, 0x6d, 0x1f, 0xc0, 0x1a, 0xc2, 0x1f,
+    0xf2, 0x01, 0x40, 0x1f, 0xe4, 0x00, 0x20, 0x1f, 0xf2, 0x01, 0x40, 0x1f, 0xc0, 0x1a, 0xc2, 0x1f,
+    0x20, 0xeb, 0x7d, 0x1f, 0x00, 0x00, 0x40, 0x0e, 0x50, 0x15, 0xc3, 0x09, 0x10, 0xea, 0x9d, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00,
+    0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xc0, 0xb8, 0xde, 0x04, 0xc0, 0x3d, 0x71, 0x0e,
+    0xc0, 0x07, 0x10, 0x2f, 0xc0, 0x05, 0x00, 0x2f, 0xc0, 0x05, 0x00, 0x2f, 0xc0, 0x05, 0x00, 0x2f,
+    0xc0, 0x05, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0xc0, 0x06,
+    0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0xc0, 0x06,
+    0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xe1, 0x04, 0x9e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00,
+    0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0xa1, 0x1b, 0xc0, 0x15, 0x9c, 0x00,
+    0xc0, 0xd8, 0x07, 0x00, 0xc0, 0xce, 0x01, 0x00, 0xc0, 0xa6, 0x1c, 0x00, 0xc0, 0x05, 0xc9, 0x01,
+    0xc0, 0x05, 0x80, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06,
+    0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xb8, 0xde, 0x73, 0xed, 0x09, 0x00, 0xdc, 0x13,
+    0xe9, 0x19, 0xe2, 0x05, 0xc0, 0x07, 0x40, 0x1f, 0x00, 0x8a, 0x00, 0x5c, 0x00, 0xe3, 0x00, 0x90,
+    0x08, 0xc0, 0x05, 0x30, 0x0e, 0x00, 0x89, 0x00, 0x5c, 0x00, 0xe3, 0x00, 0x90, 0x08, 0xc0, 0x05,
+    0x30, 0x0e, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0xb8, 0xde, 0x04, 0xc0, 0x3d, 0x71, 0x0e, 0xc0, 0x07, 0x10, 0x2f, 0xc0, 0x05, 0x00, 0x2f,
+    0xc0, 0x05, 0x00, 0x2f, 0xc0, 0x05, 0x00, 0x2f, 0xc0, 0x05, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xea, 0x9e, 0x01, 0xb0, 0x2b, 0xb2, 0x0b, 0xf2, 0x02, 0x30, 0x1f, 0xf4, 0x00, 0x00, 0x3f,
+    0xf2, 0x02, 0x30, 0x1f, 0xb0, 0x1b, 0xb2, 0x0b, 0x10, 0xea, 0xae, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0xb8, 0xce, 0x03, 0xc0, 0x4e, 0x71, 0x1e, 0xc0, 0x08, 0x00, 0x6d, 0xc0, 0x06, 0x00, 0x8b,
+    0xc0, 0x08, 0x00, 0x6d, 0xc0, 0x4e, 0x71, 0x1e, 0xc0, 0xc8, 0xce, 0x04, 0xc0, 0x05, 0x00, 0x00,
+    0xc0, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xeb, 0x6d, 0x1f, 0xb0, 0x1a, 0xc2, 0x1f, 0xf2, 0x01, 0x40, 0x1f, 0xe4, 0x00, 0x20, 0x1f,
+    0xf2, 0x01, 0x40, 0x1f, 0xc0, 0x1a, 0xc2, 0x1f, 0x20, 0xeb, 0x6d, 0x1f, 0x00, 0x00, 0x10, 0x1f,
+    0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xb8, 0x5e, 0xc0, 0x3e, 0x00,
+    0xc0, 0x07, 0x00, 0xc0, 0x05, 0x00, 0xc0, 0x05, 0x00, 0xc0, 0x05, 0x00, 0xc0, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xed, 0x3b,
+    0x20, 0x3f, 0x30, 0x08, 0xe2, 0x03, 0x00, 0x00, 0xb5, 0x9c, 0x03, 0x00, 0x00, 0xe5, 0x41, 0x28,
+    0x60, 0x1f, 0x70, 0xed, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x6c, 0x00, 0xfa,
+    0xff, 0x0c, 0x6c, 0x00, 0xc0, 0x06, 0x00, 0x6c, 0x00, 0xc0, 0x06, 0x00, 0x8a, 0x00, 0x30, 0xfd,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0x04, 0x20, 0x1f, 0xd0, 0x04, 0x20, 0x1f, 0xd0, 0x04, 0x20, 0x1f, 0xd0, 0x04, 0x20, 0x1f,
+    0xd0, 0x05, 0x30, 0x1f, 0xa0, 0x1a, 0xb2, 0x1f, 0x20, 0xeb, 0x6c, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x00, 0x20, 0x2f, 0xf1, 0x03, 0x80, 0x0b, 0xa0, 0x09, 0xd0, 0x05, 0x40, 0x0e, 0xe4, 0x01,
+    0x00, 0x5d, 0x9a, 0x00, 0x00, 0xb8, 0x3e, 0x00, 0x00, 0xf2, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x00, 0xf8, 0x02, 0xe3, 0x10, 0x2f,
+    0xc0, 0x6d, 0x70, 0x0a, 0xc0, 0x16, 0x6e, 0x0a, 0x6b, 0x00, 0xa8, 0xb5, 0xe1, 0xf1, 0x02, 0x40,
+    0x9e, 0x07, 0x7c, 0x0d, 0x00, 0xe0, 0x3e, 0x80, 0x9e, 0x00, 0x00, 0xeb, 0x00, 0xf4, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x05, 0x90, 0x0b, 0x40, 0x2e, 0xe6, 0x01,
+    0x00, 0xd8, 0x4e, 0x00, 0x00, 0xf1, 0x0b, 0x00, 0x00, 0xab, 0x6e, 0x00, 0x70, 0x1d, 0xe4, 0x03,
+    0xe4, 0x03, 0x70, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x20, 0x2f, 0xe1, 0x03, 0x80, 0x0b,
+    0x90, 0x0a, 0xe0, 0x05, 0x20, 0x1f, 0xe5, 0x00, 0x00, 0x7b, 0x8c, 0x00, 0x00, 0xe5, 0x2f, 0x00,
+    0x00, 0xe0, 0x0b, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0xd7, 0x00, 0x00, 0xf0, 0x4e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x04, 0x00, 0x70, 0x1c, 0x00, 0x60, 0x1d, 0x00,
+    0x40, 0x2e, 0x00, 0x30, 0x3e, 0x00, 0x20, 0x5d, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x0a, 0x00, 0x50, 0x2e, 0x00, 0x00, 0x60, 0x0c, 0x00,
+    0x00, 0x60, 0x0c, 0x00, 0x00, 0xa1, 0x0a, 0x00, 0x60, 0xef, 0x02, 0x00, 0x00, 0xc1, 0x09, 0x00,
+    0x00, 0x70, 0x0b, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x40, 0x2e, 0x00,
+    0x00, 0x00, 0xea, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0b,
+    0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b,
+    0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b, 0x50, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x03, 0x00, 0x00, 0xa1, 0x09, 0x00, 0x00, 0x80, 0x0a, 0x00,
+    0x00, 0x70, 0x0a, 0x00, 0x00, 0x60, 0x2d, 0x00, 0x00, 0x00, 0xfb, 0x0a, 0x00, 0x50, 0x3e, 0x00,
+    0x00, 0x70, 0x0b, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00, 0xb1, 0x08, 0x00,
+    0x60, 0xcf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xea, 0x8d, 0x12, 0x76, 0x00, 0x57, 0x31, 0xe9, 0xae, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
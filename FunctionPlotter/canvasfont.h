@@ -0,0 +1,17 @@
+#ifndef CANVASFONT_H
+#define CANVASFONT_H
+
+#define CANVAS_FONT_FIRST 32
+#define CANVAS_FONT_GLYPHS 95
+#define CANVAS_FONT_HEIGHT 16
+
+typedef struct {
+    unsigned short offset;
+    unsigned char width;
+    unsigned char advance;
+} CanvasGlyph;
+
+extern const CanvasGlyph canvasFontGlyphs[CANVAS_FONT_GLYPHS];
+extern const unsigned char canvasFontPixels[];
+
+#endif
@@ -0,0 +1,247 @@
+#include "csv.h"
+#include "platform.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define CSV_MIN_CHUNK (1 << 20)
+#define CSV_MAX_THREADS 64
+
+typedef struct {
+    const char* begin;
+    const char* end;
+    size_t rows;
+    size_t firstRow;
+    double* x;
+    double* y;
+    int xColumn;
+    int yColumn;
+    bool sorted;
+} CsvChunk;
+
+typedef struct {
+    double x, y;
+} CsvPoint;
+
+static const double powersOf10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+double ParseCsvNumber(const char* begin, const char* end) {
+    const char* p = begin;
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '"')) p++;
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '"' || end[-1] == '\r')) end--;
+    if (p == end) return NAN;
+
+    bool negative = false;
+    if (*p == '-' || *p == '+') negative = (*p++ == '-');
+
+    unsigned long long mantissa = 0;
+    int digits = 0, exponent = 0;
+    const char* start = p;
+
+    for (; p < end && (unsigned)(*p - '0') < 10; p++) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (unsigned)(*p - '0');
+            if (mantissa) digits++;
+        }
+        else exponent++;
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && (unsigned)(*p - '0') < 10; p++) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (unsigned)(*p - '0');
+                if (mantissa) digits++;
+                exponent--;
+            }
+        }
+    }
+    if (p == start || (p == start + 1 && *start == '.')) return NAN;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negativeExp = false;
+        if (p < end && (*p == '-' || *p == '+')) negativeExp = (*p++ == '-');
+        if (p == end) return NAN;
+
+        int e = 0;
+        for (; p < end && (unsigned)(*p - '0') < 10; p++) {
+            if (e < 10000) e = e * 10 + (*p - '0');
+        }
+        exponent += negativeExp ? -e : e;
+    }
+    if (p != end) return NAN;
+
+    double value = (double)mantissa;
+    if (mantissa < (1ull << 53) && exponent >= -22 && exponent <= 22) {
+        value = exponent < 0 ? value / powersOf10[-exponent] : value * powersOf10[exponent];
+    }
+    else if (mantissa != 0) {
+        value = value * pow(10.0, exponent / 2) * pow(10.0, exponent - exponent / 2);
+    }
+    return negative ? -value : value;
+}
+
+static bool IsBlankLine(const char* begin, const char* end) {
+    return begin == end || (end - begin == 1 && *begin == '\r');
+}
+
+static void CountChunkRows(void* arg) {
+    CsvChunk* chunk = arg;
+    size_t rows = 0;
+    const char* p = chunk->begin;
+
+    while (p < chunk->end) {
+        const char* eol = memchr(p, '\n', chunk->end - p);
+        if (!eol) eol = chunk->end;
+        if (!IsBlankLine(p, eol)) rows++;
+        p = eol + 1;
+    }
+    chunk->rows = rows;
+}
+
+static void ParseChunkRows(void* arg) {
+    CsvChunk* chunk = arg;
+    size_t row = chunk->firstRow;
+    const char* p = chunk->begin;
+    double previous = -INFINITY;
+    chunk->sorted = true;
+
+    while (p < chunk->end) {
+        const char* eol = memchr(p, '\n', chunk->end - p);
+        if (!eol) eol = chunk->end;
+
+        if (!IsBlankLine(p, eol)) {
+            double x = (double)row, y = NAN;
+            const char* field = p;
+            for (int column = 0; field <= eol; column++) {
+                const char* sep = memchr(field, ',', eol - field);
+                if (!sep) sep = eol;
+                if (column == chunk->xColumn) x = ParseCsvNumber(field, sep);
+                if (column == chunk->yColumn) y = ParseCsvNumber(field, sep);
+                if (column >= chunk->xColumn && column >= chunk->yColumn) break;
+                field = sep + 1;
+            }
+            chunk->x[row] = x;
+            chunk->y[row] = y;
+            if (!(x >= previous)) chunk->sorted = false;
+            previous = x;
+            row++;
+        }
+        p = eol + 1;
+    }
+}
+
+static void RunChunks(CsvChunk* chunks, int count, ThreadProc proc) {
+    Thread threads[CSV_MAX_THREADS];
+    bool started[CSV_MAX_THREADS] = { false };
+
+    for (int i = 1; i < count; i++) {
+        started[i] = StartThread(&threads[i], proc, &chunks[i]);
+    }
+    proc(&chunks[0]);
+    for (int i = 1; i < count; i++) {
+        if (started[i]) JoinThread(&threads[i]);
+        else proc(&chunks[i]);
+    }
+}
+
+// Unparsable x (NAN) sorts last so those rows can be cut off
+static int ComparePoints(const void* a, const void* b) {
+    double xa = ((const CsvPoint*)a)->x, xb = ((const CsvPoint*)b)->x;
+    if (isnan(xa) || isnan(xb)) return isnan(xa) - isnan(xb);
+    return (xa > xb) - (xa < xb);
+}
+
+// Range queries and drawing need x ascending; returns the rows left after
+// dropping those without an x
+static size_t SortRows(double* x, double* y, size_t rows) {
+    CsvPoint* points = malloc(sizeof(CsvPoint) * rows);
+    if (!points) return 0;
+
+    for (size_t i = 0; i < rows; i++) points[i] = (CsvPoint){ x[i], y[i] };
+    qsort(points, rows, sizeof(CsvPoint), ComparePoints);
+    while (rows > 0 && isnan(points[rows - 1].x)) rows--;
+    for (size_t i = 0; i < rows; i++) {
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+    }
+
+    free(points);
+    return rows;
+}
+
+Series LoadSeriesFromCsv(const char* fileName, int xColumn, int yColumn) {
+    Series s = { 0 };
+    MappedFile file;
+    if (yColumn < 0 || !MapFileReadOnly(fileName, &file)) return s;
+
+    const char* begin = file.data;
+    const char* end = begin + file.size;
+
+    const char* firstLine = begin;
+    while (firstLine < end && (*firstLine == ' ' || *firstLine == '\t')) firstLine++;
+    if (firstLine < end && !strchr("0123456789+-.", *firstLine)) {
+        const char* eol = memchr(begin, '\n', end - begin);
+        begin = eol ? eol + 1 : end;
+    }
+
+    size_t size = (size_t)(end - begin);
+    int chunkCount = GetProcessorCount();
+    if (chunkCount > CSV_MAX_THREADS) chunkCount = CSV_MAX_THREADS;
+    if ((size_t)chunkCount > size / CSV_MIN_CHUNK + 1) chunkCount = (int)(size / CSV_MIN_CHUNK + 1);
+
+    CsvChunk chunks[CSV_MAX_THREADS];
+    const char* chunkBegin = begin;
+    for (int i = 0; i < chunkCount; i++) {
+        const char* chunkEnd = (i == chunkCount - 1) ? end : begin + size / chunkCount * (i + 1);
+        if (chunkEnd < chunkBegin) chunkEnd = chunkBegin;
+        if (chunkEnd < end) {
+            const char* eol = memchr(chunkEnd, '\n', end - chunkEnd);
+            chunkEnd = eol ? eol + 1 : end;
+        }
+        chunks[i] = (CsvChunk){ chunkBegin, chunkEnd, 0, 0, NULL, NULL, xColumn, yColumn, true };
+        chunkBegin = chunkEnd;
+    }
+
+    RunChunks(chunks, chunkCount, CountChunkRows);
+
+    size_t rows = 0;
+    for (int i = 0; i < chunkCount; i++) {
+        chunks[i].firstRow = rows;
+        rows += chunks[i].rows;
+    }
+
+    double* data = rows ? malloc(sizeof(double) * rows * 2) : NULL;
+    if (!data) {
+        UnmapFile(&file);
+        return s;
+    }
+
+    for (int i = 0; i < chunkCount; i++) {
+        chunks[i].x = data;
+        chunks[i].y = data + rows;
+    }
+    RunChunks(chunks, chunkCount, ParseChunkRows);
+    UnmapFile(&file);
+
+    // Each chunk checked its own rows; the seams between chunks are left
+    bool sorted = true;
+    for (int i = 0; i < chunkCount; i++) {
+        size_t first = chunks[i].firstRow;
+        if (!chunks[i].sorted || (first > 0 && chunks[i].rows > 0 && !(data[first] >= data[first - 1]))) sorted = false;
+    }
+    size_t count = sorted ? rows : SortRows(data, data + rows, rows);
+    if (count == 0) {
+        free(data);
+        return s;
+    }
+
+    s.count = count;
+    s.x = data;
+    s.y = data + rows;
+    s.data = data;
+    BuildSeriesPyramid(&s);
+    return s;
+}
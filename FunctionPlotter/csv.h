@@ -0,0 +1,11 @@
+#ifndef CSV_H
+#define CSV_H
+
+#include "series.h"
+
+// xColumn < 0 uses the row index as x; unparsable fields become NAN. Rows are
+// returned sorted by x, and rows whose x is unparsable are dropped.
+Series LoadSeriesFromCsv(const char* fileName, int xColumn, int yColumn);
+double ParseCsvNumber(const char* begin, const char* end);
+
+#endif
@@ -0,0 +1,307 @@
+#include "diskcache.h"
+#include "functions.h"
+#include "platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    int64_t index;
+    int32_t level;
+    int32_t record;     // -1 for an empty slot
+} DiskIndexSlot;
+
+// Record numbers below mappedRecords are in the mapping, the next
+// writingCount in writing (queued for or being appended by the writer
+// thread), the rest in pending
+typedef struct {
+    FunctionPtr func;
+    bool usable;
+    bool flushing;
+    char path[512];
+    MappedFile map;
+    int mappedRecords;
+    DiskTileRecord* writing;
+    int writingCount;
+    int writingCapacity;
+    DiskTileRecord* pending;
+    int pendingCount;
+    int pendingCapacity;
+    DiskIndexSlot* slots;
+    int slotCapacity;
+    int recordCount;
+} DiskFile;
+
+static Mutex mutex;
+static Condition wake;
+static Thread writer;
+static bool stopping = false;
+static bool opened = false;
+static char directory[256];
+static DiskFile files[DISK_CACHE_MAX_FILES];
+static int fileCount = 0;
+
+static unsigned int HashKey(int level, int64_t index) {
+    uint64_t h = ((uint64_t)index ^ ((uint64_t)(uint32_t)level << 40)) * 0x9E3779B97F4A7C15ull;
+    return (unsigned int)(h >> 32);
+}
+
+static DiskIndexSlot* FindSlot(DiskIndexSlot* slots, int capacity, int level, int64_t index) {
+    unsigned int i = HashKey(level, index) & (capacity - 1);
+    while (slots[i].record >= 0 && !(slots[i].level == level && slots[i].index == index)) {
+        i = (i + 1) & (capacity - 1);
+    }
+    return &slots[i];
+}
+
+// Open addressing kept at most half full
+static bool AddToIndex(DiskFile* file, int level, int64_t index, int record) {
+    if ((file->recordCount + 1) * 2 > file->slotCapacity) {
+        int capacity = file->slotCapacity ? file->slotCapacity * 2 : 256;
+        DiskIndexSlot* slots = malloc(sizeof(DiskIndexSlot) * capacity);
+        if (!slots) return false;
+        for (int i = 0; i < capacity; i++) slots[i].record = -1;
+
+        for (int i = 0; i < file->slotCapacity; i++) {
+            if (file->slots[i].record >= 0) {
+                *FindSlot(slots, capacity, file->slots[i].level, file->slots[i].index) = file->slots[i];
+            }
+        }
+        free(file->slots);
+        file->slots = slots;
+        file->slotCapacity = capacity;
+    }
+
+    DiskIndexSlot* slot = FindSlot(file->slots, file->slotCapacity, level, index);
+    if (slot->record < 0) file->recordCount++;
+    *slot = (DiskIndexSlot){ index, level, record };
+    return true;
+}
+
+static DiskCacheHeader MakeHeader(const char* name, int version) {
+    DiskCacheHeader header = { 0 };
+    memcpy(header.magic, DISK_CACHE_MAGIC, 8);
+    header.version = DISK_CACHE_VERSION;
+    header.tileSamples = TILE_SAMPLES;
+    header.functionVersion = (uint32_t)version;
+    snprintf(header.functionName, sizeof(header.functionName), "%s", name);
+    return header;
+}
+
+// Maps a file with the expected header and whole records; returns how many, or -1
+static int MapDiskRecords(DiskFile* file, const DiskCacheHeader* expected) {
+    if (!MapFileReadOnly(file->path, &file->map)) return -1;
+
+    const DiskCacheHeader* header = file->map.data;
+    size_t body = file->map.size - sizeof(DiskCacheHeader);
+    bool valid = file->map.size >= sizeof(DiskCacheHeader) &&
+        memcmp(header, expected, sizeof(DiskCacheHeader)) == 0 &&
+        body % sizeof(DiskTileRecord) == 0;
+
+    if (!valid) {
+        UnmapFile(&file->map);
+        return -1;
+    }
+    return (int)(body / sizeof(DiskTileRecord));
+}
+
+static DiskFile* GetDiskFile(FunctionPtr func) {
+    for (int i = 0; i < fileCount; i++) {
+        if (files[i].func == func) return &files[i];
+    }
+    if (fileCount == DISK_CACHE_MAX_FILES) return NULL;
+
+    DiskFile* file = &files[fileCount++];
+    *file = (DiskFile){ .func = func };
+
+    const char* name = GetFunctionName(func);
+    if (!name) return file;
+
+    int version = GetFunctionVersion(func);
+    snprintf(file->path, sizeof(file->path), "%s/%s-v%d.tiles", directory, name, version);
+    file->usable = true;
+
+    // A file from another format, version or a torn write is ignored and replaced on the first flush
+    DiskCacheHeader expected = MakeHeader(name, version);
+    int count = MapDiskRecords(file, &expected);
+    if (count > 0) {
+        const DiskTileRecord* records = (const DiskTileRecord*)((const DiskCacheHeader*)file->map.data + 1);
+        for (int i = 0; i < count; i++) {
+            AddToIndex(file, records[i].level, records[i].index, i);
+        }
+        file->mappedRecords = count;
+    }
+    return file;
+}
+
+// Hands the pending records to the writer thread; the tile path only swaps buffers
+static void BeginFlush(DiskFile* file) {
+    DiskTileRecord* writing = file->pending;
+    int writingCapacity = file->pendingCapacity;
+    file->pending = file->writing;
+    file->pendingCapacity = file->writingCapacity;
+    file->writing = writing;
+    file->writingCapacity = writingCapacity;
+    file->writingCount = file->pendingCount;
+    file->pendingCount = 0;
+    file->flushing = true;
+    SignalCondition(&wake);
+}
+
+// Called and returns with the mutex held, which is released around the file
+// write. The writing records are already indexed by their position after the
+// mapped ones, so once they are on disk a fresh mapping covers them and the
+// index is left as it is. Mapped records read as misses while the file is
+// unmapped: Windows cannot write a file that has a live view.
+static void WriteDiskFile(DiskFile* file) {
+    DiskCacheHeader expected = MakeHeader(GetFunctionName(file->func), GetFunctionVersion(file->func));
+    bool append = file->map.data != NULL;
+    UnmapFile(&file->map);
+    UnlockMutex(&mutex);
+
+    if (!DirectoryExists(directory)) MakeDirectory(directory);
+    FILE* out = fopen(file->path, append ? "ab" : "wb");
+    bool ok = out != NULL;
+    if (ok && !append) ok = fwrite(&expected, sizeof(expected), 1, out) == 1;
+    if (ok) ok = fwrite(file->writing, sizeof(DiskTileRecord), file->writingCount, out) == (size_t)file->writingCount;
+    if (out && fclose(out) != 0) ok = false;
+
+    LockMutex(&mutex);
+    int expectedCount = file->mappedRecords + file->writingCount;
+    if (ok && MapDiskRecords(file, &expected) == expectedCount) {
+        file->mappedRecords = expectedCount;
+    }
+    else {
+        UnmapFile(&file->map);
+        file->usable = false;
+    }
+    file->writingCount = 0;
+    file->flushing = false;
+}
+
+// Once stopping, the records still pending are flushed too before the writer exits
+static DiskFile* NextFlush(void) {
+    for (int i = 0; i < fileCount; i++) {
+        if (files[i].flushing) return &files[i];
+    }
+    for (int i = 0; stopping && i < fileCount; i++) {
+        if (files[i].usable && files[i].pendingCount > 0) {
+            BeginFlush(&files[i]);
+            return &files[i];
+        }
+    }
+    return NULL;
+}
+
+static void DiskWriter(void* arg) {
+    (void)arg;
+    LockMutex(&mutex);
+    for (;;) {
+        DiskFile* file = NextFlush();
+        if (file) WriteDiskFile(file);
+        else if (stopping) break;
+        else WaitCondition(&wake, &mutex);
+    }
+    UnlockMutex(&mutex);
+}
+
+bool OpenDiskCache(const char* path) {
+    if (opened) return true;
+    if (snprintf(directory, sizeof(directory), "%s", path) >= (int)sizeof(directory)) return false;
+    if (!InitMutex(&mutex)) return false;
+    if (!InitCondition(&wake)) {
+        DestroyMutex(&mutex);
+        return false;
+    }
+
+    stopping = false;
+    if (!StartThread(&writer, DiskWriter, NULL)) {
+        DestroyCondition(&wake);
+        DestroyMutex(&mutex);
+        return false;
+    }
+    opened = true;
+    return true;
+}
+
+void CloseDiskCache(void) {
+    if (!opened) return;
+
+    LockMutex(&mutex);
+    stopping = true;
+    SignalCondition(&wake);
+    UnlockMutex(&mutex);
+    JoinThread(&writer);
+
+    for (int i = 0; i < fileCount; i++) {
+        UnmapFile(&files[i].map);
+        free(files[i].writing);
+        free(files[i].pending);
+        free(files[i].slots);
+    }
+    fileCount = 0;
+    DestroyCondition(&wake);
+    DestroyMutex(&mutex);
+    opened = false;
+}
+
+bool LoadDiskTile(Tile* tile) {
+    if (!opened) return false;
+
+    LockMutex(&mutex);
+    DiskFile* file = GetDiskFile(tile->func);
+    const DiskTileRecord* record = NULL;
+
+    if (file && file->usable && file->slotCapacity > 0) {
+        int r = FindSlot(file->slots, file->slotCapacity, tile->level, tile->index)->record;
+        if (r >= 0 && r < file->mappedRecords) {
+            if (file->map.data) record = (const DiskTileRecord*)((const DiskCacheHeader*)file->map.data + 1) + r;
+        }
+        else if (r >= 0 && r < file->mappedRecords + file->writingCount) {
+            record = &file->writing[r - file->mappedRecords];
+        }
+        else if (r >= 0) {
+            record = &file->pending[r - file->mappedRecords - file->writingCount];
+        }
+    }
+
+    if (record) {
+        memcpy(tile->samples, record->samples, sizeof(tile->samples));
+        tile->minY = record->minY;
+        tile->maxY = record->maxY;
+    }
+    UnlockMutex(&mutex);
+    return record != NULL;
+}
+
+void StoreDiskTile(const Tile* tile, float costNs) {
+    if (!opened || costNs < DISK_CACHE_MIN_COST_NS) return;
+
+    LockMutex(&mutex);
+    DiskFile* file = GetDiskFile(tile->func);
+    // A tile can already be on file when it missed because a flush had the file unmapped
+    bool stored = file && file->slotCapacity > 0 &&
+        FindSlot(file->slots, file->slotCapacity, tile->level, tile->index)->record >= 0;
+    if (file && file->usable && !stored) {
+        if (file->pendingCount == file->pendingCapacity) {
+            int capacity = file->pendingCapacity ? file->pendingCapacity * 2 : DISK_CACHE_FLUSH_TILES;
+            DiskTileRecord* pending = realloc(file->pending, sizeof(DiskTileRecord) * capacity);
+            if (pending) {
+                file->pending = pending;
+                file->pendingCapacity = capacity;
+            }
+        }
+
+        if (file->pendingCount < file->pendingCapacity) {
+            DiskTileRecord* record = &file->pending[file->pendingCount];
+            *record = (DiskTileRecord){ .level = tile->level, .index = tile->index, .minY = tile->minY, .maxY = tile->maxY };
+            memcpy(record->samples, tile->samples, sizeof(record->samples));
+
+            if (AddToIndex(file, tile->level, tile->index, file->mappedRecords + file->writingCount + file->pendingCount)) {
+                file->pendingCount++;
+            }
+            if (file->pendingCount >= DISK_CACHE_FLUSH_TILES && !file->flushing) BeginFlush(file);
+        }
+    }
+    UnlockMutex(&mutex);
+}
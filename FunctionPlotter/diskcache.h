@@ -0,0 +1,47 @@
+#ifndef DISKCACHE_H
+#define DISKCACHE_H
+
+#include "tilecache.h"
+#include <stdint.h>
+
+// Tile file per registered function, <directory>/<name>-v<version>.tiles
+// (little-endian): DiskCacheHeader, then DiskTileRecord entries in the order
+// the tiles were evaluated. Records are read through a read-only mapping and
+// new tiles are appended in batches by a writer thread; bumping a function's
+// version in the registry starts a fresh file.
+#define DISK_CACHE_MAGIC "WYKRTIL1"
+#define DISK_CACHE_VERSION 1
+#define DISK_CACHE_MAX_FILES 32
+// New tiles are held in memory and written out this many at a time
+#define DISK_CACHE_FLUSH_TILES 64
+// Only functions at least this slow per sample are worth a disk round trip
+#ifndef DISK_CACHE_MIN_COST_NS
+#define DISK_CACHE_MIN_COST_NS 1000.0f
+#endif
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t tileSamples;
+    uint32_t functionVersion;
+    uint32_t reserved;
+    char functionName[32];
+} DiskCacheHeader;
+
+typedef struct {
+    int32_t level;
+    int32_t reserved;
+    int64_t index;
+    float minY, maxY;
+    float samples[TILE_SAMPLES];
+} DiskTileRecord;
+
+// Starts the writer thread; the directory is created on the first write
+bool OpenDiskCache(const char* directory);
+void CloseDiskCache(void);
+// Fills samples and range of a tile whose func, level and index are set
+bool LoadDiskTile(Tile* tile);
+// Queues an evaluated tile for writing if its function is slow enough; never writes itself
+void StoreDiskTile(const Tile* tile, float costNs);
+
+#endif
@@ -0,0 +1,97 @@
+#include "evalcache.h"
+#include "platform.h"
+#include <stdlib.h>
+#include <string.h>
+
+static Mutex mutex;
+static bool initialized = false;
+static bool enabled = true;
+static Evaluation* buckets[EVAL_CACHE_BUCKETS];
+
+static unsigned int HashGrid(FunctionPtr func, float xMin, float xMax, int count) {
+    unsigned int bits[2];
+    memcpy(&bits[0], &xMin, sizeof(float));
+    memcpy(&bits[1], &xMax, sizeof(float));
+
+    unsigned int h = (unsigned int)((size_t)func >> 4) * 2654435761u;
+    h = (h ^ bits[0]) * 2246822519u;
+    h = (h ^ bits[1]) * 3266489917u;
+    h = (h ^ (unsigned int)count) * 668265263u;
+    return (h ^ (h >> 15)) % EVAL_CACHE_BUCKETS;
+}
+
+bool InitEvalCache(void) {
+    if (initialized) return true;
+    initialized = InitMutex(&mutex);
+    return initialized;
+}
+
+// Evaluations still referenced by live graphs are freed here as well
+void ShutdownEvalCache(void) {
+    if (!initialized) return;
+
+    for (int i = 0; i < EVAL_CACHE_BUCKETS; i++) {
+        while (buckets[i]) {
+            Evaluation* next = buckets[i]->next;
+            free(buckets[i]);
+            buckets[i] = next;
+        }
+    }
+    DestroyMutex(&mutex);
+    initialized = false;
+}
+
+void SetEvalCacheEnabled(bool value) {
+    enabled = value;
+}
+
+Evaluation* AcquireEvaluation(FunctionPtr func, float xMin, float xMax, int count) {
+    if (!initialized || !enabled) return NULL;
+
+    LockMutex(&mutex);
+    Evaluation* e = buckets[HashGrid(func, xMin, xMax, count)];
+    while (e && !(e->func == func && e->xMin == xMin && e->xMax == xMax && e->count == count)) e = e->next;
+    if (e) e->refCount++;
+    UnlockMutex(&mutex);
+    return e;
+}
+
+// Samples live in the same allocation, right after the header
+Evaluation* CreateEvaluation(FunctionPtr func, float xMin, float xMax, int count) {
+    Evaluation* e = malloc(sizeof(Evaluation) + sizeof(float) * count);
+    if (!e) return NULL;
+
+    *e = (Evaluation){ .func = func, .xMin = xMin, .xMax = xMax, .count = count, .refCount = 1 };
+    e->samples = (float*)(e + 1);
+    return e;
+}
+
+// Another thread may have published the same grid meanwhile; the newer
+// one shadows it for lookups and both stay valid for their holders
+void PublishEvaluation(Evaluation* e) {
+    if (!initialized || !enabled) return;
+
+    LockMutex(&mutex);
+    Evaluation** bucket = &buckets[HashGrid(e->func, e->xMin, e->xMax, e->count)];
+    e->next = *bucket;
+    *bucket = e;
+    e->published = true;
+    UnlockMutex(&mutex);
+}
+
+void ReleaseEvaluation(Evaluation* e) {
+    if (!e) return;
+    if (!e->published) {
+        free(e);
+        return;
+    }
+
+    LockMutex(&mutex);
+    if (--e->refCount == 0) {
+        Evaluation** link = &buckets[HashGrid(e->func, e->xMin, e->xMax, e->count)];
+        while (*link != e) link = &(*link)->next;
+        *link = e->next;
+        free(e);
+    }
+    UnlockMutex(&mutex);
+}
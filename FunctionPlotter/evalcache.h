@@ -0,0 +1,36 @@
+#ifndef EVALCACHE_H
+#define EVALCACHE_H
+
+#include "graph.h"
+
+#define EVAL_CACHE_BUCKETS 256
+
+// Samples of one function on one x grid (count points from xMin to xMax).
+// Every Function that samples the same (function, grid) holds a reference to
+// the same evaluation, so repeated curves across graphs and frames are
+// computed once; the last ReleaseEvaluation frees it.
+typedef struct Evaluation {
+    FunctionPtr func;
+    float xMin, xMax;
+    int count;
+    float* samples;
+    float sampledMin, sampledMax;
+    int refCount;
+    bool published;
+    struct Evaluation* next;
+} Evaluation;
+
+// Without InitEvalCache (or with the cache disabled) every request gets a
+// private evaluation, which is how the benchmark measures raw sampling
+bool InitEvalCache(void);
+void ShutdownEvalCache(void);
+void SetEvalCacheEnabled(bool enabled);
+
+// A published evaluation of func on the grid with one more reference, or NULL
+Evaluation* AcquireEvaluation(FunctionPtr func, float xMin, float xMax, int count);
+// Unshared evaluation with one reference; fill samples, then publish it
+Evaluation* CreateEvaluation(FunctionPtr func, float xMin, float xMax, int count);
+void PublishEvaluation(Evaluation* evaluation);
+void ReleaseEvaluation(Evaluation* evaluation);
+
+#endif
@@ -0,0 +1,476 @@
+#include "export.h"
+#include "canvas.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+typedef enum {
+    ALIGN_LEFT,
+    ALIGN_CENTER,
+    ALIGN_RIGHT
+} TextAlign;
+
+typedef struct {
+    char text[64];
+    float x, y;
+    int size;
+    TextAlign align;
+    Color color;
+} VectorText;
+
+typedef struct {
+    Color color;
+    float width;
+    Vector2* points;
+    int pointCount, pointCapacity;
+    int* runs;
+    int runCount, runCapacity;
+    bool failed;
+} VectorPath;
+
+typedef struct {
+    VectorPath* paths;
+    int pathCount, pathCapacity;
+    VectorText* texts;
+    int textCount, textCapacity;
+    bool failed;
+} VectorScene;
+
+// An allocation failure sets failed and later appends are dropped, so the
+// buffer is checked once before it is written
+typedef struct {
+    char* data;
+    size_t length, capacity;
+    bool failed;
+} TextBuffer;
+
+static void Append(TextBuffer* buffer, const char* format, ...) {
+    if (buffer->failed) return;
+
+    va_list args;
+    va_start(args, format);
+    int needed = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (needed < 0) {
+        buffer->failed = true;
+        return;
+    }
+
+    if (buffer->length + needed + 1 > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+        while (buffer->length + needed + 1 > capacity) capacity *= 2;
+        char* data = realloc(buffer->data, capacity);
+        if (!data) {
+            buffer->failed = true;
+            return;
+        }
+        buffer->data = data;
+        buffer->capacity = capacity;
+    }
+
+    va_start(args, format);
+    vsnprintf(buffer->data + buffer->length, buffer->capacity - buffer->length, format, args);
+    va_end(args);
+    buffer->length += needed;
+}
+
+static float ScreenX(const Graph* graph, float x) {
+    return x * graph->scaleX + graph->offsetX;
+}
+
+static float ScreenY(const Graph* graph, float y) {
+    return y * graph->scaleY + graph->offsetY;
+}
+
+// NULL on failure, leaving data and capacity as they were
+static void* GrowArray(void* data, int* capacity, int initial, size_t elementSize) {
+    int grownCapacity = *capacity ? *capacity * 2 : initial;
+    void* grown = realloc(data, elementSize * grownCapacity);
+    if (grown) *capacity = grownCapacity;
+    return grown;
+}
+
+// NULL when out of memory; the scene is then marked failed
+static VectorPath* AddPath(VectorScene* scene, Color color, float width) {
+    if (scene->pathCount == scene->pathCapacity) {
+        VectorPath* paths = GrowArray(scene->paths, &scene->pathCapacity, 8, sizeof(VectorPath));
+        if (!paths) {
+            scene->failed = true;
+            return NULL;
+        }
+        scene->paths = paths;
+    }
+    VectorPath* path = &scene->paths[scene->pathCount++];
+    *path = (VectorPath){ .color = color, .width = width };
+    return path;
+}
+
+// Like Append, runs and points are dropped once the path has failed
+static void BeginRun(VectorPath* path) {
+    if (path->failed) return;
+    if (path->runCount == path->runCapacity) {
+        int* runs = GrowArray(path->runs, &path->runCapacity, 16, sizeof(int));
+        if (!runs) {
+            path->failed = true;
+            return;
+        }
+        path->runs = runs;
+    }
+    path->runs[path->runCount++] = path->pointCount;
+}
+
+static void AddPoint(VectorPath* path, float x, float y) {
+    if (path->failed) return;
+    if (path->pointCount == path->pointCapacity) {
+        Vector2* points = GrowArray(path->points, &path->pointCapacity, 64, sizeof(Vector2));
+        if (!points) {
+            path->failed = true;
+            return;
+        }
+        path->points = points;
+    }
+    path->points[path->pointCount++] = (Vector2){ x, y };
+}
+
+static void AddSegment(VectorPath* path, float x0, float y0, float x1, float y1) {
+    BeginRun(path);
+    AddPoint(path, x0, y0);
+    AddPoint(path, x1, y1);
+}
+
+static void AddText(VectorScene* scene, const char* text, float x, float y, int size, TextAlign align, Color color) {
+    if (scene->textCount == scene->textCapacity) {
+        VectorText* texts = GrowArray(scene->texts, &scene->textCapacity, 32, sizeof(VectorText));
+        if (!texts) {
+            scene->failed = true;
+            return;
+        }
+        scene->texts = texts;
+    }
+    VectorText* t = &scene->texts[scene->textCount++];
+    snprintf(t->text, sizeof(t->text), "%s", text);
+    t->x = x;
+    t->y = y;
+    t->size = size;
+    t->align = align;
+    t->color = color;
+}
+
+static int RunEnd(const VectorPath* path, int run) {
+    return run + 1 < path->runCount ? path->runs[run + 1] : path->pointCount;
+}
+
+// Ramer-Douglas-Peucker over one run, compacting the kept points in place
+static int SimplifyRun(Vector2* points, int count, float tolerance) {
+    if (count < 3) return count;
+
+    bool* keep = calloc(count, sizeof(bool));
+    int* stack = malloc(sizeof(int) * count * 2);
+    if (!keep || !stack) {
+        free(keep);
+        free(stack);
+        return count;
+    }
+
+    int top = 0;
+    keep[0] = keep[count - 1] = true;
+    stack[top++] = 0;
+    stack[top++] = count - 1;
+
+    while (top > 0) {
+        int last = stack[--top];
+        int first = stack[--top];
+        Vector2 a = points[first], b = points[last];
+        float dx = b.x - a.x, dy = b.y - a.y;
+        float length = sqrtf(dx * dx + dy * dy);
+
+        float maxDistance = 0;
+        int index = -1;
+        for (int i = first + 1; i < last; i++) {
+            float px = points[i].x - a.x, py = points[i].y - a.y;
+            float distance = length > 0 ? fabsf(px * dy - py * dx) / length : sqrtf(px * px + py * py);
+            if (distance > maxDistance) {
+                maxDistance = distance;
+                index = i;
+            }
+        }
+
+        if (index >= 0 && maxDistance > tolerance) {
+            keep[index] = true;
+            stack[top++] = first;
+            stack[top++] = index;
+            stack[top++] = index;
+            stack[top++] = last;
+        }
+    }
+
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (keep[i]) points[kept++] = points[i];
+    }
+    free(keep);
+    free(stack);
+    return kept;
+}
+
+static void SimplifyPath(VectorPath* path, float tolerance) {
+    int out = 0;
+    for (int run = 0; run < path->runCount; run++) {
+        int start = path->runs[run];
+        int count = RunEnd(path, run) - start;
+        memmove(&path->points[out], &path->points[start], sizeof(Vector2) * count);
+        path->runs[run] = out;
+        out += SimplifyRun(&path->points[out], count, tolerance);
+    }
+    path->pointCount = out;
+}
+
+// False when out of memory
+static bool BuildScene(Graph* graph, VectorScene* scene) {
+    SampleGraph(graph);
+
+    Rectangle b = graph->bounds;
+    float bottom = b.y + b.height;
+    bool xAxisVisible = graph->yMin <= 0 && graph->yMax >= 0;
+    bool yAxisVisible = graph->xMin <= 0 && graph->xMax >= 0;
+    float zeroX = ScreenX(graph, 0);
+    float zeroY = ScreenY(graph, 0);
+    char text[32];
+
+    VectorPath* frame = AddPath(scene, GRAY, 2);
+    if (!frame) return false;
+    BeginRun(frame);
+    AddPoint(frame, b.x + 1, b.y + 1);
+    AddPoint(frame, b.x + b.width - 1, b.y + 1);
+    AddPoint(frame, b.x + b.width - 1, bottom - 1);
+    AddPoint(frame, b.x + 1, bottom - 1);
+    AddPoint(frame, b.x + 1, b.y + 1);
+
+    VectorPath* axes = AddPath(scene, DARKGRAY, 1);
+    if (!axes) return false;
+    if (yAxisVisible) AddSegment(axes, zeroX, b.y, zeroX, bottom);
+    if (xAxisVisible) AddSegment(axes, b.x, zeroY, b.x + b.width, zeroY);
+
+    VectorPath* ticks = AddPath(scene, GRAY, 1);
+    if (!ticks) return false;
+
+    float xStep = GetOptimalStep(graph->xMax - graph->xMin);
+    long long xFirst, xLast;
+    for (bool ok = GetTickRange(graph->xMin, graph->xMax, xStep, &xFirst, &xLast); ok && xFirst <= xLast; xFirst++) {
+        float sx = ScreenX(graph, xFirst * xStep);
+        if (sx < b.x || sx > b.x + b.width) continue;
+
+        float axisY = xAxisVisible ? zeroY : bottom;
+        AddSegment(ticks, sx, axisY - 5, sx, axisY + 5);
+        FormatTickLabel(text, sizeof(text), xStep, xFirst);
+        AddText(scene, text, sx, axisY + 8, 10, ALIGN_CENTER, GRAY);
+    }
+
+    float yStep = GetOptimalStep(graph->yMax - graph->yMin);
+    long long yFirst, yLast;
+    for (bool ok = GetTickRange(graph->yMin, graph->yMax, yStep, &yFirst, &yLast); ok && yFirst <= yLast; yFirst++) {
+        float sy = ScreenY(graph, yFirst * yStep);
+        if (sy < b.y || sy > bottom) continue;
+
+        float axisX = yAxisVisible ? zeroX : b.x;
+        AddSegment(ticks, axisX - 5, sy, axisX + 5, sy);
+        FormatTickLabel(text, sizeof(text), yStep, yFirst);
+        AddText(scene, text, axisX - 8, sy - 5, 10, ALIGN_RIGHT, GRAY);
+    }
+
+    if (graph->title) AddText(scene, graph->title, b.x + b.width / 2, b.y - 25, 16, ALIGN_CENTER, BLACK);
+    if (graph->xLabel) AddText(scene, graph->xLabel, b.x + b.width - 10, bottom + 25, 14, ALIGN_RIGHT, BLACK);
+    if (graph->yLabel) AddText(scene, graph->yLabel, b.x - 25, b.y + 10, 14, ALIGN_LEFT, BLACK);
+
+    for (int i = 0; i < graph->functionCount; i++) {
+        const Function* f = &graph->functions[i];
+        float step = f->sampleStep;
+        VectorPath* curve = AddPath(scene, f->color, 1);
+        if (!curve) return false;
+        bool inRun = false;
+
+        for (int j = 0; j < f->sampleCount; j++) {
+            float y = f->samples[j];
+            float sx = ScreenX(graph, f->sampleX0 + j * step);
+            float sy = ScreenY(graph, y);
+
+            if (isfinite(y) && sy >= b.y - 10 && sy <= bottom + 10) {
+                if (!inRun) BeginRun(curve);
+                AddPoint(curve, sx, sy);
+                inRun = true;
+            }
+            else {
+                inRun = false;
+            }
+        }
+        SimplifyPath(curve, EXPORT_TOLERANCE);
+    }
+
+    for (int i = 0; i < scene->pathCount; i++) {
+        if (scene->paths[i].failed) return false;
+    }
+    return !scene->failed;
+}
+
+static void UnloadScene(VectorScene* scene) {
+    for (int i = 0; i < scene->pathCount; i++) {
+        free(scene->paths[i].points);
+        free(scene->paths[i].runs);
+    }
+    free(scene->paths);
+    free(scene->texts);
+}
+
+static bool WriteBuffer(const TextBuffer* buffer, const char* fileName) {
+    if (buffer->failed || !buffer->data) return false;
+
+    FILE* out = fopen(fileName, "wb");
+    if (!out) return false;
+    bool ok = fwrite(buffer->data, 1, buffer->length, out) == buffer->length;
+    if (fclose(out) != 0) ok = false;
+    return ok;
+}
+
+static void AppendEscaped(TextBuffer* buffer, const char* text, bool pdf) {
+    for (const char* c = text; *c; c++) {
+        if (pdf && (*c == '(' || *c == ')' || *c == '\\')) Append(buffer, "\\%c", *c);
+        else if (!pdf && *c == '<') Append(buffer, "&lt;");
+        else if (!pdf && *c == '>') Append(buffer, "&gt;");
+        else if (!pdf && *c == '&') Append(buffer, "&amp;");
+        else Append(buffer, "%c", *c);
+    }
+}
+
+// Texts sharing size and color reuse the class of the first one
+static int FindTextStyle(const VectorScene* scene, int index) {
+    const VectorText* t = &scene->texts[index];
+    for (int i = 0; i < index; i++) {
+        const VectorText* s = &scene->texts[i];
+        if (s->size == t->size && ColorToInt(s->color) == ColorToInt(t->color)) return i;
+    }
+    return index;
+}
+
+bool ExportGraphSvg(Graph* graph, int width, int height, const char* fileName) {
+    VectorScene scene = { 0 };
+    if (!BuildScene(graph, &scene)) {
+        UnloadScene(&scene);
+        return false;
+    }
+
+    TextBuffer svg = { 0 };
+    Append(&svg, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\" viewBox=\"0 0 %d %d\">\n", width, height, width, height);
+
+    Append(&svg, "<style>path{fill:none}text{font-family:sans-serif;dominant-baseline:hanging}");
+    for (int i = 0; i < scene.textCount; i++) {
+        if (FindTextStyle(&scene, i) != i) continue;
+        Color c = scene.texts[i].color;
+        Append(&svg, ".t%d{font-size:%dpx;fill:#%02x%02x%02x}", i, scene.texts[i].size, c.r, c.g, c.b);
+    }
+    Append(&svg, "</style>\n");
+    Append(&svg, "<rect width=\"100%%\" height=\"100%%\" fill=\"#%02x%02x%02x\"/>\n", RAYWHITE.r, RAYWHITE.g, RAYWHITE.b);
+
+    for (int i = 0; i < scene.pathCount; i++) {
+        const VectorPath* path = &scene.paths[i];
+        if (path->pointCount == 0) continue;
+
+        Append(&svg, "<path stroke=\"#%02x%02x%02x\" stroke-width=\"%g\" d=\"", path->color.r, path->color.g, path->color.b, path->width);
+        for (int run = 0; run < path->runCount; run++) {
+            int start = path->runs[run], end = RunEnd(path, run);
+            if (end - start < 2) continue;
+            Append(&svg, "M%.1f %.1fL", path->points[start].x, path->points[start].y);
+            for (int p = start + 1; p < end; p++) {
+                Append(&svg, "%.1f %.1f%s", path->points[p].x, path->points[p].y, p + 1 < end ? " " : "");
+            }
+        }
+        Append(&svg, "\"/>\n");
+    }
+
+    static const char* anchors[] = { "start", "middle", "end" };
+    for (int i = 0; i < scene.textCount; i++) {
+        const VectorText* t = &scene.texts[i];
+        Append(&svg, "<text class=\"t%d\" x=\"%.1f\" y=\"%.1f\"", FindTextStyle(&scene, i), t->x, t->y);
+        if (t->align != ALIGN_LEFT) Append(&svg, " text-anchor=\"%s\"", anchors[t->align]);
+        Append(&svg, ">");
+        AppendEscaped(&svg, t->text, false);
+        Append(&svg, "</text>\n");
+    }
+    Append(&svg, "</svg>\n");
+
+    bool ok = WriteBuffer(&svg, fileName);
+    free(svg.data);
+    UnloadScene(&scene);
+    return ok;
+}
+
+bool ExportGraphPdf(Graph* graph, int width, int height, const char* fileName) {
+    VectorScene scene = { 0 };
+    if (!BuildScene(graph, &scene)) {
+        UnloadScene(&scene);
+        return false;
+    }
+
+    TextBuffer content = { 0 };
+    Append(&content, "1 0 0 -1 0 %d cm\n", height);
+    Append(&content, "%.3f %.3f %.3f rg 0 0 %d %d re f\n", RAYWHITE.r / 255.0f, RAYWHITE.g / 255.0f, RAYWHITE.b / 255.0f, width, height);
+    Append(&content, "1 J 1 j\n");
+
+    for (int i = 0; i < scene.pathCount; i++) {
+        const VectorPath* path = &scene.paths[i];
+        if (path->pointCount == 0) continue;
+
+        Append(&content, "%.3f %.3f %.3f RG %g w\n", path->color.r / 255.0f, path->color.g / 255.0f, path->color.b / 255.0f, path->width);
+        for (int run = 0; run < path->runCount; run++) {
+            int start = path->runs[run], end = RunEnd(path, run);
+            if (end - start < 2) continue;
+            Append(&content, "%.1f %.1f m\n", path->points[start].x, path->points[start].y);
+            for (int p = start + 1; p < end; p++) {
+                Append(&content, "%.1f %.1f l\n", path->points[p].x, path->points[p].y);
+            }
+        }
+        Append(&content, "S\n");
+    }
+
+    for (int i = 0; i < scene.textCount; i++) {
+        const VectorText* t = &scene.texts[i];
+        float x = t->x;
+        if (t->align == ALIGN_CENTER) x -= MeasureSoftwareText(t->text, t->size) / 2.0f;
+        if (t->align == ALIGN_RIGHT) x -= MeasureSoftwareText(t->text, t->size);
+
+        Append(&content, "BT %.3f %.3f %.3f rg /F1 %d Tf 1 0 0 -1 %.1f %.1f Tm (",
+            t->color.r / 255.0f, t->color.g / 255.0f, t->color.b / 255.0f, t->size, x, t->y + t->size * 0.8f);
+        AppendEscaped(&content, t->text, true);
+        Append(&content, ") Tj ET\n");
+    }
+
+    TextBuffer pdf = { 0 };
+    size_t offsets[6];
+    Append(&pdf, "%%PDF-1.4\n");
+    offsets[1] = pdf.length;
+    Append(&pdf, "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+    offsets[2] = pdf.length;
+    Append(&pdf, "2 0 obj\n<< /Type /Pages /Kids [3 0 R] /Count 1 >>\nendobj\n");
+    offsets[3] = pdf.length;
+    Append(&pdf, "3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 %d %d] /Contents 4 0 R /Resources << /Font << /F1 5 0 R >> >> >>\nendobj\n", width, height);
+    offsets[4] = pdf.length;
+    Append(&pdf, "4 0 obj\n<< /Length %zu >>\nstream\n", content.length);
+    Append(&pdf, "%s", content.data ? content.data : "");
+    Append(&pdf, "endstream\nendobj\n");
+    offsets[5] = pdf.length;
+    Append(&pdf, "5 0 obj\n<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica >>\nendobj\n");
+
+    size_t xref = pdf.length;
+    Append(&pdf, "xref\n0 6\n0000000000 65535 f \n");
+    for (int i = 1; i < 6; i++) {
+        Append(&pdf, "%010zu 00000 n \n", offsets[i]);
+    }
+    Append(&pdf, "trailer\n<< /Size 6 /Root 1 0 R >>\nstartxref\n%zu\n%%%%EOF\n", xref);
+
+    bool ok = !content.failed && WriteBuffer(&pdf, fileName);
+    free(content.data);
+    free(pdf.data);
+    UnloadScene(&scene);
+    return ok;
+}
@@ -0,0 +1,12 @@
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include "graph.h"
+
+// Curves are simplified with Ramer-Douglas-Peucker to within this many pixels
+#define EXPORT_TOLERANCE 0.25f
+
+bool ExportGraphSvg(Graph* graph, int width, int height, const char* fileName);
+bool ExportGraphPdf(Graph* graph, int width, int height, const char* fileName);
+
+#endif
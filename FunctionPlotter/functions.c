@@ -0,0 +1,55 @@
+#include "functions.h"
+#include <string.h>
+#include <math.h>
+
+float expFunction(float x) {
+    return expf(x);
+}
+
+float exponential(float x) {
+    return expf(x * 0.5f);
+}
+
+float logarithmic(float x) {
+    return (x > 0) ? logf(x) : NAN;
+}
+
+static const NamedFunction namedFunctions[] = {
+    { "sin", sinf, "sin(x)", 1 },
+    { "cos", cosf, "cos(x)", 1 },
+    { "tan", tanf, "tan(x)", 1 },
+    { "exp", expFunction, "exp(x)", 1 },
+    { "exponential", exponential, "exp(x * 0.5)", 1 },
+    { "log", logarithmic, "(x > 0.0 ? log(x) : intBitsToFloat(0x7fc00000))", 1 },
+};
+
+#define NAMED_FUNCTION_COUNT (int)(sizeof(namedFunctions) / sizeof(namedFunctions[0]))
+
+FunctionPtr FindFunction(const char* name) {
+    for (int i = 0; i < NAMED_FUNCTION_COUNT; i++) {
+        if (strcmp(namedFunctions[i].name, name) == 0) return namedFunctions[i].func;
+    }
+    return NULL;
+}
+
+static const NamedFunction* FindNamedFunction(FunctionPtr func) {
+    for (int i = 0; i < NAMED_FUNCTION_COUNT; i++) {
+        if (namedFunctions[i].func == func) return &namedFunctions[i];
+    }
+    return NULL;
+}
+
+const char* GetFunctionName(FunctionPtr func) {
+    const NamedFunction* f = FindNamedFunction(func);
+    return f ? f->name : NULL;
+}
+
+const char* GetFunctionGlsl(FunctionPtr func) {
+    const NamedFunction* f = FindNamedFunction(func);
+    return f ? f->glsl : NULL;
+}
+
+int GetFunctionVersion(FunctionPtr func) {
+    const NamedFunction* f = FindNamedFunction(func);
+    return f ? f->version : 0;
+}
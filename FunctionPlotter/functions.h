@@ -0,0 +1,22 @@
+#ifndef FUNCTIONS_H
+#define FUNCTIONS_H
+
+#include "graph.h"
+
+typedef struct {
+    const char* name;
+    FunctionPtr func;
+    const char* glsl;   // Same function as a GLSL expression in x, NULL if it has none
+    int version;        // Bump when the definition changes so cached tiles are dropped
+} NamedFunction;
+
+float expFunction(float x);
+float exponential(float x);
+float logarithmic(float x);
+
+FunctionPtr FindFunction(const char* name);
+const char* GetFunctionName(FunctionPtr func);
+const char* GetFunctionGlsl(FunctionPtr func);
+int GetFunctionVersion(FunctionPtr func);
+
+#endif
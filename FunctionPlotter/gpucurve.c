@@ -0,0 +1,194 @@
+#include "gpucurve.h"
+#include "functions.h"
+#include "platform.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GPU_CURVE_MAX_SHADERS 16
+#define GPU_CURVE_VERTICES 6
+
+typedef struct {
+    FunctionPtr func;
+    unsigned int shader;    // 0 when the function has no GLSL form or failed to build
+    int mvp, xMin, xStep, transform, bounds, color;
+} CurveShader;
+
+static const char* vertexTemplate =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"     // segment, end (0/1), side (-1/1)
+    "uniform mat4 mvp;\n"
+    "uniform float xMin;\n"
+    "uniform float xStep;\n"
+    "uniform vec4 transform;\n"     // scale x/y, offset x/y
+    "uniform vec4 bounds;\n"        // left, top, right, bottom
+    "out float side;\n"
+    "float f(float x) { return %s; }\n"
+    "vec2 ToScreen(float i) {\n"
+    "    float x = xMin + i * xStep;\n"
+    "    return vec2(x, f(x)) * transform.xy + transform.zw;\n"
+    "}\n"
+    "bool Visible(vec2 p) {\n"
+    "    return !isnan(p.y) && !isinf(p.y) && all(greaterThanEqual(p, bounds.xy)) && all(lessThanEqual(p, bounds.zw));\n"
+    "}\n"
+    "void main() {\n"
+    "    vec2 a = ToScreen(vertexPosition.x);\n"
+    "    vec2 b = ToScreen(vertexPosition.x + 1.0);\n"
+    "    side = vertexPosition.z;\n"
+    "    if (!Visible(a) || !Visible(b)) {\n"
+    "        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"
+    "        return;\n"
+    "    }\n"
+    "    vec2 d = b - a;\n"
+    "    float len = length(d);\n"
+    "    vec2 n = len > 1e-4 ? vec2(-d.y, d.x) / len : vec2(0.0);\n"
+    "    vec2 p = (vertexPosition.y > 0.5 ? b : a) + n * side;\n"
+    "    gl_Position = mvp * vec4(p, 0.0, 1.0);\n"
+    "}\n";
+
+// Same profile as the CPU feathered quads: full alpha on the centre line
+static const char* fragmentCode =
+    "#version 330\n"
+    "in float side;\n"
+    "uniform vec4 color;\n"
+    "out vec4 finalColor;\n"
+    "void main() {\n"
+    "    finalColor = vec4(color.rgb, color.a * (1.0 - abs(side)));\n"
+    "}\n";
+
+static bool ready = false;
+static bool enabled = true;
+static unsigned int vao = 0;
+static unsigned int vbo = 0;
+static CurveShader shaders[GPU_CURVE_MAX_SHADERS];
+static int shaderCount = 0;
+
+// Software rasterizers run the curve shader per vertex on the CPU, slower than sampling there
+static bool IsSoftwareRenderer(void) {
+    static const char* softwareNames[] = { "llvmpipe", "softpipe", "GDI Generic", "SwiftShader", "Microsoft Basic Render" };
+    if (getenv("LIBGL_ALWAYS_SOFTWARE")) return true;
+
+    const char* renderer = GetGlRendererName();
+    if (!renderer) return false;
+    for (int i = 0; i < (int)(sizeof(softwareNames) / sizeof(softwareNames[0])); i++) {
+        if (strstr(renderer, softwareNames[i])) return true;
+    }
+    return false;
+}
+
+bool LoadGpuCurves(void) {
+    if (rlGetVersion() < RL_OPENGL_33 || rlGetVersion() == RL_OPENGL_ES_20) return false;
+    if (IsSoftwareRenderer()) return false;
+
+    float* corners = malloc(sizeof(float) * 3 * GPU_CURVE_VERTICES * GPU_CURVE_MAX_SEGMENTS);
+    if (!corners) return false;
+
+    static const float quad[GPU_CURVE_VERTICES][2] = { { 0, -1 }, { 1, -1 }, { 1, 1 }, { 0, -1 }, { 1, 1 }, { 0, 1 } };
+    float* c = corners;
+    for (int s = 0; s < GPU_CURVE_MAX_SEGMENTS; s++) {
+        for (int v = 0; v < GPU_CURVE_VERTICES; v++) {
+            *c++ = (float)s;
+            *c++ = quad[v][0];
+            *c++ = quad[v][1];
+        }
+    }
+
+    vao = rlLoadVertexArray();
+    if (vao != 0 && rlEnableVertexArray(vao)) {
+        vbo = rlLoadVertexBuffer(corners, (int)(sizeof(float) * 3 * GPU_CURVE_VERTICES * GPU_CURVE_MAX_SEGMENTS), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+        rlDisableVertexArray();
+    }
+    free(corners);
+
+    ready = vao != 0 && vbo != 0;
+    if (!ready) UnloadGpuCurves();
+    return ready;
+}
+
+void UnloadGpuCurves(void) {
+    for (int i = 0; i < shaderCount; i++) {
+        if (shaders[i].shader != 0) rlUnloadShaderProgram(shaders[i].shader);
+    }
+    shaderCount = 0;
+    if (vbo != 0) rlUnloadVertexBuffer(vbo);
+    if (vao != 0) rlUnloadVertexArray(vao);
+    vao = vbo = 0;
+    ready = false;
+}
+
+// Shaders are built on first use and cached per function, failures included
+static const CurveShader* GetCurveShader(FunctionPtr func) {
+    for (int i = 0; i < shaderCount; i++) {
+        if (shaders[i].func == func) return &shaders[i];
+    }
+    if (shaderCount == GPU_CURVE_MAX_SHADERS) return NULL;
+
+    CurveShader* s = &shaders[shaderCount++];
+    *s = (CurveShader){ .func = func };
+
+    const char* glsl = GetFunctionGlsl(func);
+    char vertexCode[2048];
+    if (!glsl || snprintf(vertexCode, sizeof(vertexCode), vertexTemplate, glsl) >= (int)sizeof(vertexCode)) return s;
+
+    unsigned int id = rlLoadShaderCode(vertexCode, fragmentCode);
+    if (id == 0 || id == rlGetShaderIdDefault()) return s;
+
+    s->shader = id;
+    s->mvp = rlGetLocationUniform(id, "mvp");
+    s->xMin = rlGetLocationUniform(id, "xMin");
+    s->xStep = rlGetLocationUniform(id, "xStep");
+    s->transform = rlGetLocationUniform(id, "transform");
+    s->bounds = rlGetLocationUniform(id, "bounds");
+    s->color = rlGetLocationUniform(id, "color");
+    return s;
+}
+
+bool IsGpuCurveAvailable(FunctionPtr func) {
+    if (!ready || !enabled) return false;
+    const CurveShader* s = GetCurveShader(func);
+    return s && s->shader != 0;
+}
+
+void ToggleGpuCurves(void) {
+    enabled = !enabled;
+}
+
+void DrawGpuCurve(const Graph* graph, FunctionPtr func, Color color) {
+    const CurveShader* s = GetCurveShader(func);
+    if (!ready || !s || s->shader == 0) return;
+
+    int segments = (int)(graph->bounds.width * GPU_CURVE_SAMPLES_PER_PIXEL);
+    if (segments > GPU_CURVE_MAX_SEGMENTS) segments = GPU_CURVE_MAX_SEGMENTS;
+    if (segments < 1) return;
+
+    float xMin = graph->xMin;
+    float xStep = (graph->xMax - graph->xMin) / segments;
+    float transform[4] = { graph->scaleX, graph->scaleY, graph->offsetX, graph->offsetY };
+    // Same 10 px margin the CPU path uses to break off-screen runs
+    float bounds[4] = {
+        graph->bounds.x - 10, graph->bounds.y - 10,
+        graph->bounds.x + graph->bounds.width + 10, graph->bounds.y + graph->bounds.height + 10
+    };
+    float tint[4] = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+
+    // Whatever is queued in the default batch must land underneath the curve
+    rlDrawRenderBatchActive();
+    rlEnableShader(s->shader);
+    rlSetUniformMatrix(s->mvp, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlSetUniform(s->xMin, &xMin, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(s->xStep, &xStep, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(s->transform, transform, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(s->bounds, bounds, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(s->color, tint, RL_SHADER_UNIFORM_VEC4, 1);
+
+    // Quads on either side of the curve wind in opposite directions
+    rlDisableBackfaceCulling();
+    rlEnableVertexArray(vao);
+    rlDrawVertexArray(0, segments * GPU_CURVE_VERTICES);
+    rlDisableVertexArray();
+    rlEnableBackfaceCulling();
+    rlDisableShader();
+}
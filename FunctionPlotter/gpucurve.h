@@ -0,0 +1,21 @@
+#ifndef GPUCURVE_H
+#define GPUCURVE_H
+
+#include "graph.h"
+
+// Registered functions with a GLSL form can be evaluated in a vertex shader:
+// one static vertex buffer of (segment, end, side) corners is expanded into
+// feathered line quads on the GPU, so the CPU cost of a curve no longer
+// depends on its sample count. Needs GL 3.3; under software GL
+// (LIBGL_ALWAYS_SOFTWARE) or if a shader fails to build, curves stay on
+// the CPU path.
+#define GPU_CURVE_SAMPLES_PER_PIXEL 2
+#define GPU_CURVE_MAX_SEGMENTS 8192
+
+bool LoadGpuCurves(void);
+void UnloadGpuCurves(void);
+bool IsGpuCurveAvailable(FunctionPtr func);
+void ToggleGpuCurves(void);
+void DrawGpuCurve(const Graph* graph, FunctionPtr func, Color color);
+
+#endif
@@ -1,7 +1,19 @@
 #include "graph.h"
 #include "utils.h"
+#include "canvas.h"
+#include "textbatch.h"
+#include "gpucurve.h"
+#include "axislink.h"
+#include "evalcache.h"
+#include "tilecache.h"
+#include "analysis.h"
+#include "profiler.h"
+#include "platform.h"
 #include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
 #include <math.h>
+#include <limits.h>
 
 Graph CreateGraph(Rectangle bounds) {
     Graph g = {
@@ -10,27 +22,98 @@ Graph CreateGraph(Rectangle bounds) {
         .yMin = -1, .yMax = 1,
         .scaleX = 1, .scaleY = 1,
         .functionCount = 0,
+        .functionCapacity = 0,
         .functions = NULL,
+        .seriesCount = 0,
+        .seriesCapacity = 0,
+        .series = NULL,
+        .streamCount = 0,
+        .streamCapacity = 0,
+        .streams = NULL,
+        .followStream = false,
+        .autoFitY = false,
+        .showStats = false,
+        .sampleBudget = GRAPH_SAMPLE_BUDGET,
         .dragging = false,
         .xLabel = "X",
         .yLabel = "Y",
         .title = "Wykres funkcji"
     };
+    UpdateGraphTransform(&g);
     return g;
 }
 
+// Arena-owned graphs never free; the old array stays in the arena until the set is unloaded
+static void* GrowGraphArray(Graph* graph, void* data, int count, int capacity, size_t elementSize) {
+    if (!graph->arena) return realloc(data, elementSize * capacity);
+
+    void* grown = ArenaAlloc(graph->arena, elementSize * capacity);
+    if (grown && count > 0) memcpy(grown, data, elementSize * count);
+    return grown;
+}
+
 void AddFunctionToGraph(Graph* graph, FunctionPtr func, Color color) {
-    graph->functions = realloc(graph->functions, sizeof(Function) * (graph->functionCount + 1));
-    graph->functions[graph->functionCount++] = (Function){ func, color };
+    if (graph->functionCount == graph->functionCapacity) {
+        int capacity = graph->functionCapacity ? graph->functionCapacity * 2 : 4;
+        graph->functions = GrowGraphArray(graph, graph->functions, graph->functionCount, capacity, sizeof(Function));
+        graph->functionCapacity = capacity;
+    }
+    graph->functions[graph->functionCount++] = (Function){ .func = func, .color = color };
+}
+
+void AddSeriesToGraph(Graph* graph, const Series* series, Color color) {
+    if (graph->seriesCount == graph->seriesCapacity) {
+        int capacity = graph->seriesCapacity ? graph->seriesCapacity * 2 : 4;
+        graph->series = GrowGraphArray(graph, graph->series, graph->seriesCount, capacity, sizeof(SeriesPlot));
+        graph->seriesCapacity = capacity;
+    }
+    graph->series[graph->seriesCount++] = (SeriesPlot){ series, color };
+}
+
+void AttachStreamToGraph(Graph* graph, StreamSeries* stream, Color color) {
+    if (graph->streamCount == graph->streamCapacity) {
+        int capacity = graph->streamCapacity ? graph->streamCapacity * 2 : 4;
+        graph->streams = GrowGraphArray(graph, graph->streams, graph->streamCount, capacity, sizeof(StreamPlot));
+        graph->streamCapacity = capacity;
+    }
+    graph->streams[graph->streamCount++] = (StreamPlot){ stream, color };
+    graph->followStream = true;
+}
+
+static void FollowStreams(Graph* graph) {
+    bool hasData = false;
+    double newest = 0;
+
+    for (int i = 0; i < graph->streamCount; i++) {
+        StreamSeries* stream = graph->streams[i].stream;
+        DrainStreamSeries(stream);
+        if (stream->hasData && (!hasData || stream->newestX > newest)) {
+            newest = stream->newestX;
+            hasData = true;
+        }
+    }
+
+    if (graph->followStream && hasData) {
+        float span = graph->xMax - graph->xMin;
+        graph->xMax = (float)newest;
+        graph->xMin = graph->xMax - span;
+    }
 }
 
 void UpdateGraph(Graph* graph) {
-    if (CheckCollisionPointRec(GetMousePosition(), graph->bounds)) {
-        float wheel = GetMouseWheelMove();
-        if (wheel != 0) {
-            float factor = (wheel > 0) ? 0.9f : 1.1f;
-            float mx = GetMouseX();
-            float my = GetMouseY();
+    InputState input = ReadInputState();
+    UpdateGraphWithInput(graph, &input);
+}
+
+void UpdateGraphWithInput(Graph* graph, const InputState* input) {
+    PROFILE_BEGIN(update, PROFILE_UPDATE, -1);
+    PullLinkedAxis(graph);
+
+    if (CheckCollisionPointRec(input->mouse, graph->bounds)) {
+        if (input->wheel != 0) {
+            float factor = (input->wheel > 0) ? 0.9f : 1.1f;
+            float mx = input->mouse.x;
+            float my = input->mouse.y;
 
             float worldX = ScreenToWorldX(graph, mx);
             float worldY = ScreenToWorldY(graph, my);
@@ -41,26 +124,31 @@ void UpdateGraph(Graph* graph) {
             graph->yMax = worldY + (graph->yMax - worldY) * factor;
         }
 
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        if (input->leftPressed) {
             graph->dragging = true;
-            graph->dragStart = GetMousePosition();
+            graph->dragStart = input->mouse;
         }
 
-        if (IsMouseButtonDown(MOUSE_LEFT_BUTTON) && graph->dragging) {
-            Vector2 delta = Vector2Subtract(GetMousePosition(), graph->dragStart);
+        if (input->leftDown && graph->dragging) {
+            Vector2 delta = Vector2Subtract(input->mouse, graph->dragStart);
             float dx = (delta.x / graph->bounds.width) * (graph->xMax - graph->xMin);
             float dy = (delta.y / graph->bounds.height) * (graph->yMax - graph->yMin);
             graph->xMin -= dx;
             graph->xMax -= dx;
             graph->yMin += dy;
             graph->yMax += dy;
-            graph->dragStart = GetMousePosition();
+            graph->dragStart = input->mouse;
         }
 
-        if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
+        if (input->leftReleased) {
             graph->dragging = false;
         }
     }
+
+    if (graph->streamCount > 0) FollowStreams(graph);
+    PushLinkedAxis(graph);
+
+    PROFILE_END(update, 0);
 }
 
 float GetOptimalStep(float range) {
@@ -70,12 +158,356 @@ float GetOptimalStep(float range) {
     return step;
 }
 
-void DrawGraph(Graph* graph) {
-    DrawRectangleLinesEx(graph->bounds, 2, GRAY);
+typedef struct {
+    int x, top, bottom;
+    bool valid;
+} ColumnSpan;
+
+static void DrawSeriesColumn(Graph* graph, Canvas* canvas, int sx, double minY, double maxY, ColumnSpan* prev, Color color) {
+    if (!(minY <= maxY) || maxY < graph->yMin || minY > graph->yMax) {
+        prev->valid = false;
+        return;
+    }
+    if (minY < graph->yMin) minY = graph->yMin;
+    if (maxY > graph->yMax) maxY = graph->yMax;
+
+    int top = WorldToScreenY(graph, (float)maxY);
+    int bottom = WorldToScreenY(graph, (float)minY);
+
+    if (prev->valid && sx - prev->x > 1) {
+        CanvasLine(canvas, prev->x, (prev->top + prev->bottom) / 2, sx, (top + bottom) / 2, color);
+    }
+    else if (prev->valid) {
+        if (top > prev->bottom) top = prev->bottom;
+        if (bottom < prev->top) bottom = prev->top;
+    }
+    CanvasLine(canvas, sx, top, sx, bottom + 1, color);
+    *prev = (ColumnSpan){ sx, top, bottom, true };
+}
+
+static void DrawSeriesPlot(Graph* graph, Canvas* canvas, const SeriesPlot* plot) {
+    const Series* s = plot->series;
+    if (s->count == 0) return;
+
+    size_t first = FindSeriesIndex(s, graph->xMin);
+    size_t last = FindSeriesIndex(s, graph->xMax);
+    if (first > 0) first--;
+    last = (last < s->count) ? last + 1 : s->count;
+    if (last - first < 2) return;
+
+    double pixelWidth = (graph->xMax - graph->xMin) / graph->bounds.width;
+    double spacing = (s->x[last - 1] - s->x[first]) / (double)(last - first - 1);
+    double pointsPerPixel = (spacing > 0) ? pixelWidth / spacing : (double)(last - first);
+
+    int level = 0;
+    while (level < s->levelCount && (double)(2ull << level) <= pointsPerPixel) level++;
+
+    if (level == 0) {
+        Vector2 prev = { 0 };
+        bool firstPoint = true;
+
+        for (size_t i = first; i < last; i++) {
+            double y = s->y[i];
+
+            if (isfinite(y)) {
+                int sx = WorldToScreenX(graph, (float)s->x[i]);
+                int sy = WorldToScreenY(graph, (float)y);
+
+                if (sx >= graph->bounds.x - 10 && sx <= graph->bounds.x + graph->bounds.width + 10 &&
+                    sy >= graph->bounds.y - 10 && sy <= graph->bounds.y + graph->bounds.height + 10) {
+
+                    if (!firstPoint) {
+                        CanvasLine(canvas, prev.x, prev.y, sx, sy, plot->color);
+                    }
+                    prev = (Vector2){ (float)sx, (float)sy };
+                    firstPoint = false;
+                }
+                else {
+                    firstPoint = true;
+                }
+            }
+            else {
+                firstPoint = true;
+            }
+        }
+        return;
+    }
+
+    const SeriesLevel* lvl = GetSeriesLevel(s, level);
+    size_t firstBucket = first >> level;
+    size_t lastBucket = ((last - 1) >> level) + 1;
+
+    int left = (int)graph->bounds.x;
+    int right = (int)(graph->bounds.x + graph->bounds.width);
+    int column = left - 1;
+    double colMin = INFINITY, colMax = -INFINITY;
+    ColumnSpan prev = { 0 };
+
+    for (size_t b = firstBucket; b < lastBucket; b++) {
+        int sx = WorldToScreenX(graph, (float)s->x[b << level]);
+        if (sx != column) {
+            if (column >= left && column <= right) {
+                DrawSeriesColumn(graph, canvas, column, colMin, colMax, &prev, plot->color);
+            }
+            column = sx;
+            colMin = INFINITY;
+            colMax = -INFINITY;
+        }
+        colMin = fmin(colMin, lvl->minY[b]);
+        colMax = fmax(colMax, lvl->maxY[b]);
+    }
+    if (column >= left && column <= right) {
+        DrawSeriesColumn(graph, canvas, column, colMin, colMax, &prev, plot->color);
+    }
+}
+
+static void DrawStreamPlot(Graph* graph, Canvas* canvas, const StreamPlot* plot) {
+    const StreamSeries* stream = plot->stream;
+    if (!stream->hasData) return;
+
+    long long first = (long long)floor(graph->xMin / stream->columnWidth);
+    long long last = (long long)floor(graph->xMax / stream->columnWidth);
+    if (first < stream->newestColumn - stream->columnCount + 1) first = stream->newestColumn - stream->columnCount + 1;
+    if (last > stream->newestColumn) last = stream->newestColumn;
+
+    int left = (int)graph->bounds.x;
+    int right = (int)(graph->bounds.x + graph->bounds.width);
+    int column = left - 1;
+    double colMin = INFINITY, colMax = -INFINITY;
+    ColumnSpan prev = { 0 };
+
+    for (long long i = first; i <= last; i++) {
+        const StreamColumn* c = GetStreamColumn(stream, i);
+        if (!c) continue;
+
+        int sx = WorldToScreenX(graph, (float)(i * stream->columnWidth));
+        if (sx != column) {
+            if (column >= left && column <= right) {
+                DrawSeriesColumn(graph, canvas, column, colMin, colMax, &prev, plot->color);
+            }
+            column = sx;
+            colMin = INFINITY;
+            colMax = -INFINITY;
+        }
+        colMin = fmin(colMin, c->minY);
+        colMax = fmax(colMax, c->maxY);
+    }
+    if (column >= left && column <= right) {
+        DrawSeriesColumn(graph, canvas, column, colMin, colMax, &prev, plot->color);
+    }
+}
+
+// GRAPH_SAMPLES_PER_PIXEL unless the measured cost would exceed the graph's
+// budget; expensive functions drop towards one sample every two pixels
+static int GetSampleCount(Graph* graph, Function* f) {
+    int count = (int)(graph->bounds.width * GRAPH_SAMPLES_PER_PIXEL) + 1;
+    if (graph->sampleBudget <= 0 || f->stats.costNs <= 0) return count;
+
+    int affordable = (int)(graph->sampleBudget * 1e6f / f->stats.costNs);
+    int minimum = (int)(graph->bounds.width / 2) + 1;
+    if (affordable < minimum) affordable = minimum;
+    return affordable < count ? affordable : count;
+}
+
+// Samples sit on the world-aligned grid x = i * 2^level closest to the wanted
+// density, so pans and returns to an earlier zoom reuse cached tiles. Only
+// grids nobody holds yet are assembled; the previous evaluation is released
+// after acquiring, so an unchanged viewport keeps its samples.
+static void SampleFunction(Graph* graph, Function* f) {
+    if (!isfinite(graph->xMin) || !isfinite(graph->xMax) || !(graph->xMax > graph->xMin)) return;
+
+    int wanted = GetSampleCount(graph, f);
+    int level = GetTileLevel((graph->xMax - graph->xMin) / (wanted - 1.0), graph->xMin, graph->xMax);
+    double spacing = ldexp(1.0, level);
+    // One grid point past each edge so curves reach the frame
+    long long first = (long long)floor(graph->xMin / spacing);
+    long long last = (long long)ceil(graph->xMax / spacing);
+    if (last <= first) last = first + 1;
+
+    int count = (int)(last - first + 1);
+    float x0 = (float)(first * spacing);
+    float x1 = (float)(last * spacing);
+    Evaluation* e = AcquireEvaluation(f->func, x0, x1, count);
+
+    if (!e) {
+        e = CreateEvaluation(f->func, x0, x1, count);
+        if (!e) return;
+        SampleTiles(f->func, level, first, count, e->samples, &e->sampledMin, &e->sampledMax, &f->stats);
+        PublishEvaluation(e);
+    }
+
+    ReleaseEvaluation(f->evaluation);
+    f->evaluation = e;
+    f->samples = e->samples;
+    f->sampleCount = count;
+    f->sampleX0 = x0;
+    f->sampleStep = (float)spacing;
+    f->sampledMin = e->sampledMin;
+    f->sampledMax = e->sampledMax;
+}
+
+static void FitGraphY(Graph* graph) {
+    double lo = INFINITY, hi = -INFINITY;
+    double minY, maxY;
+
+    for (int i = 0; i < graph->functionCount; i++) {
+        lo = fmin(lo, graph->functions[i].sampledMin);
+        hi = fmax(hi, graph->functions[i].sampledMax);
+    }
+
+    for (int i = 0; i < graph->seriesCount; i++) {
+        const Series* s = graph->series[i].series;
+        size_t first = FindSeriesIndex(s, graph->xMin);
+        size_t last = FindSeriesIndex(s, graph->xMax);
+        while (last < s->count && s->x[last] <= graph->xMax) last++;
+        if (GetSeriesRange(s, first, last, &minY, &maxY)) {
+            lo = fmin(lo, minY);
+            hi = fmax(hi, maxY);
+        }
+    }
+
+    for (int i = 0; i < graph->streamCount; i++) {
+        if (GetStreamRange(graph->streams[i].stream, graph->xMin, graph->xMax, &minY, &maxY)) {
+            lo = fmin(lo, minY);
+            hi = fmax(hi, maxY);
+        }
+    }
+
+    if (!(lo <= hi)) return;
+
+    double pad = (hi - lo) * 0.05;
+    if (pad <= 0) pad = fmax(fabs(hi) * 0.05, 1e-3);
+    graph->yMin = (float)(lo - pad);
+    graph->yMax = (float)(hi + pad);
+}
+
+// Window curves go to the GPU when they can; autoFitY still needs CPU samples
+static bool UsesGpuCurve(const Graph* graph, const Canvas* canvas, const Function* f) {
+    return canvas && !canvas->image && !graph->autoFitY && IsGpuCurveAvailable(f->func);
+}
+
+static void SampleGraphFunctions(Graph* graph, const Canvas* canvas) {
+    PullLinkedAxis(graph);
+    for (int i = 0; i < graph->functionCount; i++) {
+        graph->functions[i].gpu = UsesGpuCurve(graph, canvas, &graph->functions[i]);
+        if (graph->functions[i].gpu) continue;
+
+        PROFILE_BEGIN(evaluate, PROFILE_EVALUATE, i);
+        SampleFunction(graph, &graph->functions[i]);
+        PROFILE_END(evaluate, graph->functions[i].sampleCount);
+    }
+
+    if (graph->autoFitY) FitGraphY(graph);
+}
+
+void SampleGraph(Graph* graph) {
+    SampleGraphFunctions(graph, NULL);
+    UpdateGraphTransform(graph);
+}
+
+static void DrawFunctionStats(Graph* graph, Canvas* canvas) {
+    char text[96];
+    int y = graph->bounds.y + 6;
+
+    for (int i = 0; i < graph->functionCount; i++) {
+        const Function* f = &graph->functions[i];
+        double nonFiniteRate = f->stats.evaluations ? 100.0 * f->stats.nonFinite / f->stats.evaluations : 0.0;
+        if (f->gpu) snprintf(text, sizeof(text), "GPU  %.1f ms total on CPU", f->stats.seconds * 1000.0);
+        else snprintf(text, sizeof(text), "%d smp  %.1f ns/eval  %.1f%% NaN/inf  %.1f ms total",
+            f->sampleCount, f->stats.costNs, nonFiniteRate, f->stats.seconds * 1000.0);
+        CanvasText(canvas, text, graph->bounds.x + 6, y, 10, f->color);
+        y += 12;
+    }
+}
+
+bool GetTickRange(float min, float max, float step, long long* first, long long* last) {
+    if (!(step > 0) || !isfinite(min / step) || !isfinite(max / step)) return false;
+    if (fabs(min / step) > 1e15 || fabs(max / step) > 1e15) return false;
+
+    *first = (long long)ceil(min / step);
+    *last = (long long)floor(max / step);
+    return true;
+}
+
+void FormatTickLabel(char* text, size_t size, float step, long long index) {
+    float value = index * step;
+    if (fabs(value) < 0.001) value = 0;
+    snprintf(text, size, "%.1f", value);
+}
+
+const TickLabel* GetTickLabel(TickCache* cache, Canvas* canvas, float step, long long index) {
+    bool software = canvas->image != NULL;
+    if (cache->step != step || cache->software != software) {
+        cache->step = step;
+        cache->software = software;
+        for (int i = 0; i < GRAPH_TICK_CACHE; i++) cache->labels[i].index = LLONG_MIN;
+    }
+
+    TickLabel* label = &cache->labels[(unsigned long long)index % GRAPH_TICK_CACHE];
+    if (label->index != index) {
+        FormatTickLabel(label->text, sizeof(label->text), step, index);
+        label->width = CanvasMeasureText(canvas, label->text, 10);
+        label->index = index;
+    }
+    return label;
+}
+
+// Keyed by the string pointer, so assigning a new title or label remeasures it
+static int GetCachedTextWidth(TextWidthCache* cache, Canvas* canvas, const char* text, int fontSize) {
+    bool software = canvas->image != NULL;
+    if (cache->text != text || cache->software != software) {
+        cache->text = text;
+        cache->software = software;
+        cache->width = CanvasMeasureText(canvas, text, fontSize);
+    }
+    return cache->width;
+}
+
+static Vector2 FeatureToScreen(const Graph* graph, const GraphFeature* feature) {
+    return (Vector2){ feature->x * graph->scaleX + graph->offsetX, feature->y * graph->scaleY + graph->offsetY };
+}
+
+// Roots and extrema in the function's colour (extrema hollow), intersections in black
+static void DrawAnalysisMarkers(Graph* graph, Canvas* canvas, const AnalysisResult* result) {
+    for (int i = 0; i < result->featureCount; i++) {
+        const GraphFeature* feature = &result->features[i];
+        Vector2 p = FeatureToScreen(graph, feature);
+        // Inclusive with a pixel of slack, so extrema on the frame (sin at yMax) still show
+        if (feature->function >= graph->functionCount ||
+            p.x < graph->bounds.x - 1 || p.x > graph->bounds.x + graph->bounds.width + 1 ||
+            p.y < graph->bounds.y - 1 || p.y > graph->bounds.y + graph->bounds.height + 1) continue;
+
+        Color color = feature->kind == FEATURE_INTERSECTION ? BLACK : graph->functions[feature->function].color;
+        CanvasCircle(canvas, p, ANALYSIS_MARKER_RADIUS, color);
+        if (feature->kind == FEATURE_MINIMUM || feature->kind == FEATURE_MAXIMUM) {
+            CanvasCircle(canvas, p, ANALYSIS_MARKER_RADIUS - 2, RAYWHITE);
+        }
+    }
+}
+
+static const GraphFeature* FindHoveredFeature(const Graph* graph, const AnalysisResult* result, Vector2 mouse) {
+    const GraphFeature* nearest = NULL;
+    float nearestDistance = (ANALYSIS_MARKER_RADIUS + 2) * (ANALYSIS_MARKER_RADIUS + 2);
+
+    for (int i = 0; i < result->featureCount; i++) {
+        Vector2 p = FeatureToScreen(graph, &result->features[i]);
+        float dx = p.x - mouse.x, dy = p.y - mouse.y;
+        if (dx * dx + dy * dy <= nearestDistance) {
+            nearest = &result->features[i];
+            nearestDistance = dx * dx + dy * dy;
+        }
+    }
+    return nearest;
+}
+
+static void DrawSampledGraphOnCanvas(Graph* graph, Canvas* canvas) {
+    PROFILE_BEGIN(axes, PROFILE_AXES, -1);
+    if (!canvas->image) SetTextLayer(TEXT_LAYER_AXES);
+    CanvasRectangleLines(canvas, graph->bounds, 2, GRAY);
 
     if (graph->title) {
-        int titleWidth = MeasureText(graph->title, 16);
-        DrawText(graph->title,
+        int titleWidth = GetCachedTextWidth(&graph->titleWidth, canvas, graph->title, 16);
+        CanvasText(canvas, graph->title,
             graph->bounds.x + (graph->bounds.width - titleWidth) / 2,
             graph->bounds.y - 25, 16, BLACK);
     }
@@ -84,34 +516,27 @@ void DrawGraph(Graph* graph) {
     float zeroY = WorldToScreenY(graph, 0);
 
     if (graph->xMin <= 0 && graph->xMax >= 0)
-        DrawLine(zeroX, graph->bounds.y, zeroX, graph->bounds.y + graph->bounds.height, DARKGRAY);
+        CanvasLine(canvas, zeroX, graph->bounds.y, zeroX, graph->bounds.y + graph->bounds.height, DARKGRAY);
 
     if (graph->yMin <= 0 && graph->yMax >= 0)
-        DrawLine(graph->bounds.x, zeroY, graph->bounds.x + graph->bounds.width, zeroY, DARKGRAY);
+        CanvasLine(canvas, graph->bounds.x, zeroY, graph->bounds.x + graph->bounds.width, zeroY, DARKGRAY);
 
     float xRange = graph->xMax - graph->xMin;
     float xStep = GetOptimalStep(xRange);
-    float xStart = ceil(graph->xMin / xStep) * xStep;
+    long long xFirst, xLast;
 
-    for (float xVal = xStart; xVal <= graph->xMax; xVal += xStep) {
-        int sx = WorldToScreenX(graph, xVal);
+    for (bool ok = GetTickRange(graph->xMin, graph->xMax, xStep, &xFirst, &xLast); ok && xFirst <= xLast; xFirst++) {
+        int sx = WorldToScreenX(graph, xFirst * xStep);
         if (sx >= graph->bounds.x && sx <= graph->bounds.x + graph->bounds.width) {
+            const TickLabel* label = GetTickLabel(&graph->xTicks, canvas, xStep, xFirst);
             if (graph->yMin <= 0 && graph->yMax >= 0) {
-                DrawLine(sx, zeroY - 5, sx, zeroY + 5, GRAY);
-                char valueText[32];
-                if (fabs(xVal) < 0.001) xVal = 0;
-                snprintf(valueText, sizeof(valueText), "%.1f", xVal);
-                int textWidth = MeasureText(valueText, 10);
-                DrawText(valueText, sx - textWidth / 2, zeroY + 8, 10, GRAY);
+                CanvasLine(canvas, sx, zeroY - 5, sx, zeroY + 5, GRAY);
+                CanvasText(canvas, label->text, sx - label->width / 2, zeroY + 8, 10, GRAY);
             }
             else {
-                DrawLine(sx, graph->bounds.y + graph->bounds.height - 5,
+                CanvasLine(canvas, sx, graph->bounds.y + graph->bounds.height - 5,
                     sx, graph->bounds.y + graph->bounds.height + 5, GRAY);
-                char valueText[32];
-                if (fabs(xVal) < 0.001) xVal = 0;
-                snprintf(valueText, sizeof(valueText), "%.1f", xVal);
-                int textWidth = MeasureText(valueText, 10);
-                DrawText(valueText, sx - textWidth / 2,
+                CanvasText(canvas, label->text, sx - label->width / 2,
                     graph->bounds.y + graph->bounds.height + 8, 10, GRAY);
             }
         }
@@ -119,82 +544,112 @@ void DrawGraph(Graph* graph) {
 
     float yRange = graph->yMax - graph->yMin;
     float yStep = GetOptimalStep(yRange);
-    float yStart = ceil(graph->yMin / yStep) * yStep;
+    long long yFirst, yLast;
 
-    for (float yVal = yStart; yVal <= graph->yMax; yVal += yStep) {
-        int sy = WorldToScreenY(graph, yVal);
+    for (bool ok = GetTickRange(graph->yMin, graph->yMax, yStep, &yFirst, &yLast); ok && yFirst <= yLast; yFirst++) {
+        int sy = WorldToScreenY(graph, yFirst * yStep);
         if (sy >= graph->bounds.y && sy <= graph->bounds.y + graph->bounds.height) {
+            const TickLabel* label = GetTickLabel(&graph->yTicks, canvas, yStep, yFirst);
             if (graph->xMin <= 0 && graph->xMax >= 0) {
-                DrawLine(zeroX - 5, sy, zeroX + 5, sy, GRAY);
-                char valueText[32];
-                if (fabs(yVal) < 0.001) yVal = 0;
-                snprintf(valueText, sizeof(valueText), "%.1f", yVal);
-                DrawText(valueText, zeroX - MeasureText(valueText, 10) - 8, sy - 5, 10, GRAY);
+                CanvasLine(canvas, zeroX - 5, sy, zeroX + 5, sy, GRAY);
+                CanvasText(canvas, label->text, zeroX - label->width - 8, sy - 5, 10, GRAY);
             }
             else {
-                DrawLine(graph->bounds.x - 5, sy, graph->bounds.x + 5, sy, GRAY);
-                char valueText[32];
-                if (fabs(yVal) < 0.001) yVal = 0;
-                snprintf(valueText, sizeof(valueText), "%.1f", yVal);
-                DrawText(valueText, graph->bounds.x - MeasureText(valueText, 10) - 8, sy - 5, 10, GRAY);
+                CanvasLine(canvas, graph->bounds.x - 5, sy, graph->bounds.x + 5, sy, GRAY);
+                CanvasText(canvas, label->text, graph->bounds.x - label->width - 8, sy - 5, 10, GRAY);
             }
         }
     }
 
     if (graph->xLabel) {
-        int labelWidth = MeasureText(graph->xLabel, 14);
-        DrawText(graph->xLabel,
+        int labelWidth = GetCachedTextWidth(&graph->xLabelWidth, canvas, graph->xLabel, 14);
+        CanvasText(canvas, graph->xLabel,
             graph->bounds.x + graph->bounds.width - labelWidth - 10,
             graph->bounds.y + graph->bounds.height + 25, 14, BLACK);
     }
 
     if (graph->yLabel) {
-        DrawText(graph->yLabel, graph->bounds.x - 25, graph->bounds.y + 10, 14, BLACK);
+        CanvasText(canvas, graph->yLabel, graph->bounds.x - 25, graph->bounds.y + 10, 14, BLACK);
     }
+    // Axis text goes out before the curves so they are drawn over it; the
+    // rest waits for the frame's DrawTextBatch
+    if (!canvas->image) {
+        DrawTextLayer(TEXT_LAYER_AXES);
+        SetTextLayer(TEXT_LAYER_OVERLAY);
+    }
+    PROFILE_END(axes, 0);
 
     for (int i = 0; i < graph->functionCount; i++) {
+        PROFILE_BEGIN(submit, PROFILE_SUBMIT, i);
         Function f = graph->functions[i];
-        Vector2 prev = { 0 };
-        bool firstPoint = true;
+        float screenX[TRANSFORM_CHUNK], screenY[TRANSFORM_CHUNK];
+        Vector2 run[TRANSFORM_CHUNK + 1];
+        int runCount = 0;
 
-        float step = (graph->xMax - graph->xMin) / (graph->bounds.width * 2);
-
-        for (float x = graph->xMin; x <= graph->xMax; x += step) {
-            float y = f.func(x);
-
-            if (isfinite(y)) {
-                int sx = WorldToScreenX(graph, x);
-                int sy = WorldToScreenY(graph, y);
-
-                if (sx >= graph->bounds.x - 10 && sx <= graph->bounds.x + graph->bounds.width + 10 &&
-                    sy >= graph->bounds.y - 10 && sy <= graph->bounds.y + graph->bounds.height + 10) {
+        if (f.gpu) {
+            DrawGpuCurve(graph, f.func, f.color);
+            f.sampleCount = 0;
+        }
 
-                    if (!firstPoint) {
-                        DrawLine(prev.x, prev.y, sx, sy, f.color);
-                    }
-                    prev = (Vector2){ (float)sx, (float)sy };
-                    firstPoint = false;
-                }
-                else {
-                    firstPoint = true;
+        for (int j = 0; j < f.sampleCount; j++) {
+            int k = j % TRANSFORM_CHUNK;
+            if (k == 0) {
+                int n = f.sampleCount - j < TRANSFORM_CHUNK ? f.sampleCount - j : TRANSFORM_CHUNK;
+                TransformSamples(graph, f.samples + j, j, n, f.sampleX0, f.sampleStep, screenX, screenY);
+            }
+            float sx = screenX[k];
+            float sy = screenY[k];
+
+            if (isfinite(f.samples[j]) &&
+                sx >= graph->bounds.x - 10 && sx <= graph->bounds.x + graph->bounds.width + 10 &&
+                sy >= graph->bounds.y - 10 && sy <= graph->bounds.y + graph->bounds.height + 10) {
+                run[runCount++] = (Vector2){ sx, sy };
+                if (runCount == TRANSFORM_CHUNK + 1) {
+                    CanvasPolyline(canvas, run, runCount, f.color);
+                    run[0] = run[runCount - 1];
+                    runCount = 1;
                 }
             }
             else {
-                firstPoint = true;
+                CanvasPolyline(canvas, run, runCount, f.color);
+                runCount = 0;
             }
         }
+        CanvasPolyline(canvas, run, runCount, f.color);
+        PROFILE_END(submit, f.sampleCount);
     }
 
-    if (CheckCollisionPointRec(GetMousePosition(), graph->bounds)) {
+    PROFILE_BEGIN(plots, PROFILE_SUBMIT, -1);
+    for (int i = 0; i < graph->seriesCount; i++) {
+        DrawSeriesPlot(graph, canvas, &graph->series[i]);
+    }
+
+    for (int i = 0; i < graph->streamCount; i++) {
+        DrawStreamPlot(graph, canvas, &graph->streams[i]);
+    }
+    PROFILE_END(plots, 0);
+
+    const AnalysisResult* analysis = UpdateGraphAnalysis(graph, canvas->image != NULL);
+    if (analysis) DrawAnalysisMarkers(graph, canvas, analysis);
+
+    if (graph->showStats) DrawFunctionStats(graph, canvas);
+
+    if (!canvas->image && CheckCollisionPointRec(GetMousePosition(), graph->bounds)) {
         Vector2 mp = GetMousePosition();
         float wx = ScreenToWorldX(graph, mp.x);
         float wy = ScreenToWorldY(graph, mp.y);
-        DrawCircleV(mp, 3, BLACK);
+        CanvasCircle(canvas, mp, 3, BLACK);
 
         char coordText[64];
-        snprintf(coordText, sizeof(coordText), "X: %.3f  Y: %.3f", wx, wy);
+        const GraphFeature* feature = analysis ? FindHoveredFeature(graph, analysis, mp) : NULL;
+        if (feature) {
+            snprintf(coordText, sizeof(coordText), "%s  X: %.4f  Y: %.4f", GetFeatureName(feature->kind), feature->x, feature->y);
+        }
+        else {
+            snprintf(coordText, sizeof(coordText), "X: %.3f  Y: %.3f", wx, wy);
+        }
 
-        int textWidth = MeasureText(coordText, 12);
+        int textWidth = CanvasMeasureText(canvas, coordText, 12);
         int textX = mp.x + 10;
         int textY = mp.y - 20;
 
@@ -205,10 +660,47 @@ void DrawGraph(Graph* graph) {
             textY = mp.y + 10;
         }
 
-        DrawText(coordText, textX, textY, 12, BLACK);
+        CanvasText(canvas, coordText, textX, textY, 12, BLACK);
+    }
+}
+
+void DrawGraph(Graph* graph) {
+    SampleGraphForCanvas(graph, NULL);
+    UpdateGraphTransform(graph);
+    DrawSampledGraph(graph, NULL);
+}
+
+void DrawGraphToImage(Graph* graph, Image* image) {
+    SampleGraphForCanvas(graph, image);
+    UpdateGraphTransform(graph);
+    DrawSampledGraph(graph, image);
+}
+
+void SampleGraphForCanvas(Graph* graph, Image* image) {
+    Canvas canvas = { image };
+    SampleGraphFunctions(graph, &canvas);
+}
+
+void DrawSampledGraph(Graph* graph, Image* image) {
+    Canvas canvas = { image };
+    DrawSampledGraphOnCanvas(graph, &canvas);
+}
+
+void ResetFunctionStats(Graph* graph) {
+    for (int i = 0; i < graph->functionCount; i++) {
+        graph->functions[i].stats = (FunctionStats){ 0 };
     }
 }
 
 void UnloadGraph(Graph* graph) {
+    SetGraphAnalysis(graph, false);
+    for (int i = 0; i < graph->functionCount; i++) {
+        ReleaseEvaluation(graph->functions[i].evaluation);
+        graph->functions[i].evaluation = NULL;
+    }
+    if (graph->arena) return;
+
     free(graph->functions);
+    free(graph->series);
+    free(graph->streams);
 }
\ No newline at end of file
@@ -3,23 +3,110 @@
 
 #include "raylib.h"
 #include "raymath.h"
+#include "series.h"
+#include "stream.h"
+#include "input.h"
+#include "arena.h"
+#include "canvas.h"
 
 typedef float (*FunctionPtr)(float);
 
+// Default per-function sampling budget in milliseconds per frame
+#define GRAPH_SAMPLE_BUDGET 1.0f
+// Curves are drawn anti-aliased through sub-pixel points, so one sample per pixel is enough
+#define GRAPH_SAMPLES_PER_PIXEL 1
+
+typedef struct {
+    long long evaluations;
+    long long nonFinite;
+    double seconds;
+    float costNs;
+} FunctionStats;
+
 typedef struct {
     FunctionPtr func;
     Color color;
+    // Points into evaluation, which may be shared with other graphs (evalcache.h)
+    const float* samples;
+    struct Evaluation* evaluation;
+    int sampleCount;
+    // samples[i] is taken at x = sampleX0 + i * sampleStep
+    float sampleX0;
+    float sampleStep;
+    float sampledMin, sampledMax;
+    // Drawn by gpucurve this frame; samples are left from the last CPU pass
+    bool gpu;
+    FunctionStats stats;
 } Function;
 
+// Tick labels are cached by tick index (value = index * step) until the step changes
+#define GRAPH_TICK_CACHE 64
+
+typedef struct {
+    long long index;
+    int width;
+    char text[32];
+} TickLabel;
+
+typedef struct {
+    float step;
+    bool software;
+    TickLabel labels[GRAPH_TICK_CACHE];
+} TickCache;
+
+typedef struct {
+    const char* text;
+    bool software;
+    int width;
+} TextWidthCache;
+
+typedef struct {
+    const Series* series;
+    Color color;
+} SeriesPlot;
+
+typedef struct {
+    StreamSeries* stream;
+    Color color;
+} StreamPlot;
+
 typedef struct {
     Rectangle bounds;
     float xMin, xMax, yMin, yMax;
+    // screen = world * scale + offset, set up after sampling by UpdateGraphTransform
+    // or, for the graphs of a GraphSet, all at once by DrawGraphSet
     float scaleX, scaleY;
+    float offsetX, offsetY;
     int functionCount;
+    int functionCapacity;
     Function* functions;
+    int seriesCount;
+    int seriesCapacity;
+    SeriesPlot* series;
+    int streamCount;
+    int streamCapacity;
+    StreamPlot* streams;
+    bool followStream;
+    bool autoFitY;
+    bool showStats;
+    float sampleBudget;
     bool dragging;
     Vector2 dragStart;
 
+    // Set when the graph belongs to a GraphSet: buffers come from its arena
+    Arena* arena;
+    int setIndex;
+
+    // Shared x viewport (axislink.h), NULL for an independent x axis
+    struct AxisLink* xLink;
+    unsigned int xLinkVersion;
+
+    // Roots, extrema and intersections (analysis.h), NULL when not shown
+    struct GraphAnalysis* analysis;
+
+    TickCache xTicks, yTicks;
+    TextWidthCache titleWidth, xLabelWidth;
+
     const char* xLabel;
     const char* yLabel;
     const char* title;
@@ -27,8 +114,27 @@ typedef struct {
 
 Graph CreateGraph(Rectangle bounds);
 void AddFunctionToGraph(Graph* graph, FunctionPtr func, Color color);
+void AddSeriesToGraph(Graph* graph, const Series* series, Color color);
+void AttachStreamToGraph(Graph* graph, StreamSeries* stream, Color color);
 void UpdateGraph(Graph* graph);
+void UpdateGraphWithInput(Graph* graph, const InputState* input);
+float GetOptimalStep(float range);
+// Ticks are whole multiples of step; false when the range has no usable ticks
+bool GetTickRange(float min, float max, float step, long long* first, long long* last);
+// Label of the tick at index * step, as drawn on screen and in exports
+void FormatTickLabel(char* text, size_t size, float step, long long index);
+// Formatted and measured label from the graph's tick cache, remeasured when the step changes
+const TickLabel* GetTickLabel(TickCache* cache, Canvas* canvas, float step, long long index);
+void SampleGraph(Graph* graph);
+// Text other than the axes is queued for the frame's DrawTextBatch
 void DrawGraph(Graph* graph);
+void DrawGraphToImage(Graph* graph, Image* image);
+// DrawGraph in two halves for callers that set up transforms in between
+// (GraphSet): sampling can move the ranges (linked axes, autoFitY) and
+// drawing reads scale and offset. image is NULL for the window.
+void SampleGraphForCanvas(Graph* graph, Image* image);
+void DrawSampledGraph(Graph* graph, Image* image);
+void ResetFunctionStats(Graph* graph);
 void UnloadGraph(Graph* graph);
 
 #endif
@@ -0,0 +1,173 @@
+#include "graphset.h"
+#include "profiler.h"
+#include <string.h>
+
+GraphSet CreateGraphSet(void) {
+    return (GraphSet){ 0 };
+}
+
+// The layout is rebuilt by UpdateGraphSetLayout, so growing it needs no copy
+static bool GrowGraphLayout(GraphSet* set, int capacity) {
+    float** columns[] = {
+        &set->layout.left, &set->layout.top, &set->layout.right, &set->layout.bottom,
+        &set->layout.xMin, &set->layout.xMax, &set->layout.yMin, &set->layout.yMax,
+        &set->layout.scaleX, &set->layout.offsetX, &set->layout.scaleY, &set->layout.offsetY
+    };
+
+    for (int i = 0; i < (int)(sizeof(columns) / sizeof(columns[0])); i++) {
+        *columns[i] = ArenaAlloc(&set->arena, sizeof(float) * capacity);
+        if (!*columns[i]) return false;
+    }
+    set->layout.visible = ArenaAlloc(&set->arena, capacity);
+    return set->layout.visible != NULL;
+}
+
+Graph* AddGraphToSet(GraphSet* set, Rectangle bounds) {
+    if (set->count == set->capacity) {
+        int capacity = set->capacity ? set->capacity * 2 : 16;
+        Graph** graphs = ArenaAlloc(&set->arena, sizeof(Graph*) * capacity);
+        if (!graphs || !GrowGraphLayout(set, capacity)) return NULL;
+        if (set->count) memcpy(graphs, set->graphs, sizeof(Graph*) * set->count);
+        set->graphs = graphs;
+        set->capacity = capacity;
+    }
+
+    Graph* graph = set->freeList;
+    if (graph) set->freeList = *(Graph**)graph;
+    else graph = ArenaAlloc(&set->arena, sizeof(Graph));
+    if (!graph) return NULL;
+
+    *graph = CreateGraph(bounds);
+    graph->arena = &set->arena;
+    graph->setIndex = set->count;
+    set->graphs[set->count++] = graph;
+    return graph;
+}
+
+AxisLink* AddAxisLinkToSet(GraphSet* set, float xMin, float xMax) {
+    AxisLink* link = ArenaAlloc(&set->arena, sizeof(AxisLink));
+    if (!link) return NULL;
+
+    *link = CreateAxisLink(xMin, xMax);
+    return link;
+}
+
+void RemoveGraphFromSet(GraphSet* set, Graph* graph) {
+    int index = graph->setIndex;
+    if (index < 0 || index >= set->count || set->graphs[index] != graph) return;
+
+    UnloadGraph(graph);
+    Graph* last = set->graphs[--set->count];
+    set->graphs[index] = last;
+    last->setIndex = index;
+
+    *(Graph**)graph = set->freeList;
+    set->freeList = graph;
+}
+
+void UnloadGraphSet(GraphSet* set) {
+    for (int i = 0; i < set->count; i++) {
+        UnloadGraph(set->graphs[i]);
+    }
+    FreeArena(&set->arena);
+    *set = (GraphSet){ 0 };
+}
+
+void UpdateGraphSetLayout(GraphSet* set) {
+    GraphLayout* l = &set->layout;
+    Graph** graphs = set->graphs;
+    int count = set->count;
+
+    for (int i = 0; i < count; i++) {
+        const Graph* g = graphs[i];
+        l->left[i] = g->bounds.x;
+        l->top[i] = g->bounds.y;
+        l->right[i] = g->bounds.x + g->bounds.width;
+        l->bottom[i] = g->bounds.y + g->bounds.height;
+    }
+}
+
+int HitTestGraphSet(const GraphSet* set, Vector2 point) {
+    const float* left = set->layout.left;
+    const float* top = set->layout.top;
+    const float* right = set->layout.right;
+    const float* bottom = set->layout.bottom;
+    int count = set->count;
+    int hit = -1;
+
+    for (int i = 0; i < count; i++) {
+        int inside = (point.x >= left[i]) & (point.x <= right[i]) & (point.y >= top[i]) & (point.y <= bottom[i]);
+        hit = inside ? i : hit;
+    }
+    return hit;
+}
+
+int CullGraphSet(GraphSet* set, Rectangle view, float margin) {
+    const float* left = set->layout.left;
+    const float* top = set->layout.top;
+    const float* right = set->layout.right;
+    const float* bottom = set->layout.bottom;
+    unsigned char* visible = set->layout.visible;
+    int count = set->count;
+
+    float viewLeft = view.x - margin, viewRight = view.x + view.width + margin;
+    float viewTop = view.y - margin, viewBottom = view.y + view.height + margin;
+    int visibleCount = 0;
+
+    for (int i = 0; i < count; i++) {
+        int overlaps = (right[i] >= viewLeft) & (left[i] <= viewRight) & (bottom[i] >= viewTop) & (top[i] <= viewBottom);
+        visible[i] = (unsigned char)overlaps;
+        visibleCount += overlaps;
+    }
+    return visibleCount;
+}
+
+static void ComputeAxisTransform(const float* screenMin, const float* screenMax, const float* worldMin,
+    const float* worldMax, float* scale, float* offset, int count) {
+    for (int i = 0; i < count; i++) {
+        float s = (screenMax[i] - screenMin[i]) / (worldMax[i] - worldMin[i]);
+        scale[i] = s;
+        offset[i] = screenMin[i] - worldMin[i] * s;
+    }
+}
+
+// Same result as UpdateGraphTransform per graph; y runs from bottom to top
+static void UpdateGraphSetTransforms(GraphSet* set) {
+    GraphLayout* l = &set->layout;
+    Graph** graphs = set->graphs;
+    int count = set->count;
+
+    for (int i = 0; i < count; i++) {
+        const Graph* g = graphs[i];
+        l->xMin[i] = g->xMin;
+        l->xMax[i] = g->xMax;
+        l->yMin[i] = g->yMin;
+        l->yMax[i] = g->yMax;
+    }
+
+    // One axis per loop keeps the runtime alias checks few enough to vectorize
+    ComputeAxisTransform(l->left, l->right, l->xMin, l->xMax, l->scaleX, l->offsetX, count);
+    ComputeAxisTransform(l->bottom, l->top, l->yMin, l->yMax, l->scaleY, l->offsetY, count);
+
+    for (int i = 0; i < count; i++) {
+        Graph* g = graphs[i];
+        g->scaleX = l->scaleX[i];
+        g->offsetX = l->offsetX[i];
+        g->scaleY = l->scaleY[i];
+        g->offsetY = l->offsetY[i];
+    }
+}
+
+void DrawGraphSet(GraphSet* set, Image* image) {
+    for (int i = 0; i < set->count; i++) {
+        ProfilerSetGraph(i);
+        if (set->layout.visible[i]) SampleGraphForCanvas(set->graphs[i], image);
+    }
+
+    UpdateGraphSetTransforms(set);
+
+    for (int i = 0; i < set->count; i++) {
+        ProfilerSetGraph(i);
+        if (set->layout.visible[i]) DrawSampledGraph(set->graphs[i], image);
+    }
+}
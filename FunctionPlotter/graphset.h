@@ -0,0 +1,58 @@
+#ifndef GRAPHSET_H
+#define GRAPHSET_H
+
+#include "graph.h"
+#include "arena.h"
+#include "axislink.h"
+
+// Per-graph values in parallel arrays, indexed like GraphSet.graphs, so the
+// passes over all graphs are plain loops the compiler can vectorize.
+// screen = world * scale + offset
+typedef struct {
+    float* left;
+    float* top;
+    float* right;
+    float* bottom;
+    float* xMin;
+    float* xMax;
+    float* yMin;
+    float* yMax;
+    float* scaleX;
+    float* offsetX;
+    float* scaleY;
+    float* offsetY;
+    unsigned char* visible;
+} GraphLayout;
+
+// Graphs and their function tables live in one arena; samples are shared
+// evaluations (evalcache.h) released when a graph is removed or unloaded.
+// Removal swaps the last graph into the hole, so order is not preserved;
+// removed graphs are recycled by later adds and memory returns in UnloadGraphSet.
+typedef struct {
+    Arena arena;
+    Graph** graphs;
+    int count;
+    int capacity;
+    Graph* freeList;
+    GraphLayout layout;
+} GraphSet;
+
+GraphSet CreateGraphSet(void);
+Graph* AddGraphToSet(GraphSet* set, Rectangle bounds);
+void RemoveGraphFromSet(GraphSet* set, Graph* graph);
+// The link lives in the set's arena and is released with it
+AxisLink* AddAxisLinkToSet(GraphSet* set, float xMin, float xMax);
+void UnloadGraphSet(GraphSet* set);
+
+// Gathers the bounds of the graphs for hit-testing and culling
+void UpdateGraphSetLayout(GraphSet* set);
+// Index of the topmost (last drawn) graph containing point, or -1
+int HitTestGraphSet(const GraphSet* set, Vector2 point);
+// Marks graphs whose bounds plus margin overlap view; returns how many are visible
+int CullGraphSet(GraphSet* set, Rectangle view, float margin);
+// Samples the visible graphs, sets up all their transforms in one pass over
+// the layout and draws them, to the window when image is NULL. Needs the
+// layout and culling of this frame.
+void DrawGraphSet(GraphSet* set, Image* image);
+
+#endif
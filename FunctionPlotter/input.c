@@ -0,0 +1,65 @@
+#include "input.h"
+#include <stdlib.h>
+
+InputState ReadInputState(void) {
+    return (InputState) {
+        .mouse = GetMousePosition(),
+        .wheel = GetMouseWheelMove(),
+        .leftPressed = IsMouseButtonPressed(MOUSE_LEFT_BUTTON),
+        .leftDown = IsMouseButtonDown(MOUSE_LEFT_BUTTON),
+        .leftReleased = IsMouseButtonReleased(MOUSE_LEFT_BUTTON),
+        .frameTime = GetFrameTime()
+    };
+}
+
+bool StartInputRecording(InputRecorder* recorder, const char* fileName) {
+    recorder->file = fopen(fileName, "w");
+    recorder->frame = 0;
+    return recorder->file != NULL;
+}
+
+void RecordInputState(InputRecorder* recorder, const InputState* state) {
+    if (!recorder->file) return;
+
+    fprintf(recorder->file, "%d %.2f %.2f %g %d %d %d %.6f\n", recorder->frame++,
+        state->mouse.x, state->mouse.y, state->wheel,
+        state->leftPressed, state->leftDown, state->leftReleased, state->frameTime);
+}
+
+void StopInputRecording(InputRecorder* recorder) {
+    if (recorder->file) fclose(recorder->file);
+    recorder->file = NULL;
+}
+
+InputState* LoadInputRecording(const char* fileName, int* frameCount) {
+    *frameCount = 0;
+    FILE* file = fopen(fileName, "r");
+    if (!file) return NULL;
+
+    int count = 0, capacity = 0;
+    InputState* states = NULL;
+    char line[256];
+
+    while (fgets(line, sizeof(line), file)) {
+        InputState s = { 0 };
+        int frame, pressed, down, released;
+        if (sscanf(line, "%d %f %f %f %d %d %d %f", &frame, &s.mouse.x, &s.mouse.y, &s.wheel,
+            &pressed, &down, &released, &s.frameTime) != 8) continue;
+
+        s.leftPressed = pressed != 0;
+        s.leftDown = down != 0;
+        s.leftReleased = released != 0;
+
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            InputState* grown = realloc(states, sizeof(InputState) * capacity);
+            if (!grown) break;
+            states = grown;
+        }
+        states[count++] = s;
+    }
+
+    fclose(file);
+    *frameCount = count;
+    return states;
+}
@@ -0,0 +1,30 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "raylib.h"
+#include <stdio.h>
+
+// Everything UpdateGraph reads from raylib in one frame
+typedef struct {
+    Vector2 mouse;
+    float wheel;
+    bool leftPressed;
+    bool leftDown;
+    bool leftReleased;
+    float frameTime;
+} InputState;
+
+typedef struct {
+    FILE* file;
+    int frame;
+} InputRecorder;
+
+InputState ReadInputState(void);
+
+// Recordings are text, one frame per line: frame mouseX mouseY wheel pressed down released frameTime
+bool StartInputRecording(InputRecorder* recorder, const char* fileName);
+void RecordInputState(InputRecorder* recorder, const InputState* state);
+void StopInputRecording(InputRecorder* recorder);
+InputState* LoadInputRecording(const char* fileName, int* frameCount);
+
+#endif
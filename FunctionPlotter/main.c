@@ -1,71 +1,317 @@
 ﻿#include "raylib.h"
 #include "graph.h"
+#include "graphset.h"
+#include "canvas.h"
+#include "textbatch.h"
+#include "gpucurve.h"
+#include "evalcache.h"
+#include "tilecache.h"
+#include "diskcache.h"
+#include "analysis.h"
+#include "functions.h"
+#include "csv.h"
+#include "batch.h"
+#include "platform.h"
+#include "profiler.h"
 #include "math.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define SCREEN_WIDTH 1200
 #define SCREEN_HEIGHT 900
+#define STREAM_RATE 1000000
+#define STREAM_BATCH 4096
+#define TRACE_FILE "trace.json"
+#define CULL_MARGIN 40
+#define DISK_CACHE_DIR "cache"
 
-float expFunction(float x) {
-    return expf(x);
+typedef struct {
+    StreamSeries* stream;
+    volatile size_t running;
+} StreamProducer;
+
+static void ProduceStreamSamples(void* arg) {
+    StreamProducer* producer = arg;
+    StreamSample batch[STREAM_BATCH];
+    unsigned int noise = 12345;
+    double start = GetHighResTime();
+    size_t produced = 0;
+
+    while (AtomicLoadAcquire(&producer->running)) {
+        size_t target = (size_t)((GetHighResTime() - start) * STREAM_RATE);
+        if (target == produced) {
+            SleepMilliseconds(1);
+            continue;
+        }
+
+        while (produced < target) {
+            size_t count = target - produced;
+            if (count > STREAM_BATCH) count = STREAM_BATCH;
+
+            for (size_t i = 0; i < count; i++) {
+                double t = (double)(produced + i) / STREAM_RATE;
+                noise = noise * 1664525u + 1013904223u;
+                batch[i] = (StreamSample){ t, sin(t * PI) + 0.2 * sin(t * 74 * PI) + (noise >> 8) / 167772160.0 - 0.05 };
+            }
+            PushStreamSamples(producer->stream, batch, count);
+            produced += count;
+        }
+    }
+}
+
+// Returns the graph that shows the live stream
+static Graph* SetupGraphs(GraphSet* set) {
+    Graph* trigGraph = AddGraphToSet(set, (Rectangle) { 50, 50, 500, 350 });
+    trigGraph->title = "Funkcje trygonometryczne";
+    trigGraph->xLabel = "x";
+    trigGraph->yLabel = "y";
+    AddFunctionToGraph(trigGraph, sinf, RED);
+    AddFunctionToGraph(trigGraph, cosf, BLUE);
+    SetGraphAnalysis(trigGraph, true);
+
+    Graph* tanGraph = AddGraphToSet(set, (Rectangle) { 650, 50, 500, 350 });
+    tanGraph->title = "Wykres Tan(x)";
+    tanGraph->xLabel = "x";
+    tanGraph->yLabel = "y";
+    tanGraph->yMin = -5;
+    tanGraph->yMax = 5;
+    AddFunctionToGraph(tanGraph, tanf, GREEN);
+
+    // The two top graphs pan and zoom along x together
+    AxisLink* topAxis = AddAxisLinkToSet(set, trigGraph->xMin, trigGraph->xMax);
+    LinkGraphAxis(trigGraph, topAxis);
+    LinkGraphAxis(tanGraph, topAxis);
+
+    Graph* expGraph = AddGraphToSet(set, (Rectangle) { 50, 500, 500, 350 });
+    expGraph->title = "Wykres e^x";
+    expGraph->xLabel = "x";
+    expGraph->yLabel = "y";
+    expGraph->xMin = -5;
+    expGraph->xMax = 5;
+    expGraph->autoFitY = true;
+    AddFunctionToGraph(expGraph, expFunction, PURPLE);
+
+    Graph* liveGraph = AddGraphToSet(set, (Rectangle) { 650, 500, 500, 350 });
+    liveGraph->title = "Strumien na zywo";
+    liveGraph->xLabel = "t";
+    liveGraph->yLabel = "y";
+    liveGraph->xMin = 0;
+    liveGraph->xMax = 5;
+    liveGraph->autoFitY = true;
+    return liveGraph;
 }
 
-float exponential(float x) {
-    return expf(x * 0.5f);
+static void DrawLegend(Canvas* canvas) {
+    CanvasText(canvas, "sin(x)", 60, 420, 12, RED);
+    CanvasText(canvas, "cos(x)", 120, 420, 12, BLUE);
 }
 
-float logarithmic(float x) {
-    return (x > 0) ? logf(x) : NAN;
+// .csv files are read as x,y columns, anything else as a binary series file
+static bool LoadSeriesFile(const char* fileName, Series* series) {
+    *series = IsFileExtension(fileName, ".csv") ? LoadSeriesFromCsv(fileName, 0, 1) : LoadSeries(fileName);
+    if (series->count > 0) return true;
+
+    fprintf(stderr, "%s: no series data\n", fileName);
+    UnloadSeries(series);
+    return false;
 }
 
-int main(void) {
+// A loaded series replaces the live stream in the bottom right graph
+static void ShowSeries(Graph* graph, const Series* series, const char* fileName) {
+    AddSeriesToGraph(graph, series, DARKBLUE);
+    graph->title = GetFileName(fileName);
+    graph->xLabel = "x";
+    graph->xMin = (float)series->x[0];
+    graph->xMax = (float)series->x[series->count - 1];
+    if (!(graph->xMax > graph->xMin)) {
+        graph->xMin -= 1;
+        graph->xMax += 1;
+    }
+}
+
+static int ExportDashboardImage(const char* fileName, const char* seriesFile) {
+    Series series = { 0 };
+    if (seriesFile && !LoadSeriesFile(seriesFile, &series)) return 1;
+
+    GraphSet graphs = CreateGraphSet();
+    Graph* live = SetupGraphs(&graphs);
+    if (seriesFile) ShowSeries(live, &series, seriesFile);
+
+    Image image = GenImageColor(SCREEN_WIDTH, SCREEN_HEIGHT, RAYWHITE);
+    Canvas canvas = { &image };
+
+    UpdateGraphSetLayout(&graphs);
+    CullGraphSet(&graphs, (Rectangle) { 0, 0, (float)image.width, (float)image.height }, CULL_MARGIN);
+    DrawGraphSet(&graphs, &image);
+    DrawLegend(&canvas);
+
+    bool exported = ExportImage(image, fileName);
+    UnloadImage(image);
+
+    UnloadGraphSet(&graphs);
+    UnloadSeries(&series);
+    return exported ? 0 : 1;
+}
+
+static int CompareFrameTimes(const void* a, const void* b) {
+    double da = *(const double*)a, db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+// Replays a recorded session through UpdateGraphWithInput and the software canvas.
+// The live stream is left out because its samples depend on wall-clock time.
+static int ReplayInputRecording(const char* fileName) {
+    int frameCount;
+    InputState* frames = LoadInputRecording(fileName, &frameCount);
+    if (!frames || frameCount == 0) {
+        free(frames);
+        return 1;
+    }
+
+    double* times = malloc(sizeof(double) * frameCount);
+    if (!times) {
+        fprintf(stderr, "%s: out of memory for %d frame times\n", fileName, frameCount);
+        free(frames);
+        return 1;
+    }
+
+    GraphSet graphs = CreateGraphSet();
+    SetupGraphs(&graphs);
+
+    Image image = GenImageColor(SCREEN_WIDTH, SCREEN_HEIGHT, RAYWHITE);
+    double total = 0;
+
+    for (int f = 0; f < frameCount; f++) {
+        double start = GetHighResTime();
+        ImageClearBackground(&image, RAYWHITE);
+        UpdateGraphSetLayout(&graphs);
+        CullGraphSet(&graphs, (Rectangle) { 0, 0, (float)image.width, (float)image.height }, CULL_MARGIN);
+        for (int i = 0; i < graphs.count; i++) {
+            ProfilerSetGraph(i);
+            UpdateGraphWithInput(graphs.graphs[i], &frames[f]);
+        }
+        DrawGraphSet(&graphs, &image);
+        times[f] = (GetHighResTime() - start) * 1000.0;
+        total += times[f];
+    }
+
+    qsort(times, frameCount, sizeof(double), CompareFrameTimes);
+    int slowFrames = 0;
+    while (slowFrames < frameCount && times[frameCount - 1 - slowFrames] > 1000.0 / 60) slowFrames++;
+
+    printf("Replayed %d frames: mean %.3f ms, p50 %.3f, p90 %.3f, p99 %.3f, max %.3f, %d over 16.7 ms\n",
+        frameCount, total / frameCount, times[frameCount / 2], times[frameCount * 9 / 10],
+        times[frameCount * 99 / 100], times[frameCount - 1], slowFrames);
+
+    free(times);
+    UnloadImage(image);
+    UnloadGraphSet(&graphs);
+    free(frames);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (InitEvalCache()) atexit(ShutdownEvalCache);
+    if (InitTileCache(TILE_CACHE_LIMIT)) atexit(ShutdownTileCache);
+    if (OpenDiskCache(DISK_CACHE_DIR)) atexit(CloseDiskCache);
+
+    if (argc == 3 && strcmp(argv[1], "--png") == 0) {
+        return ExportDashboardImage(argv[2], NULL);
+    }
+    if (argc == 5 && strcmp(argv[1], "--series") == 0 && strcmp(argv[3], "--png") == 0) {
+        return ExportDashboardImage(argv[4], argv[2]);
+    }
+    if (argc >= 3 && strcmp(argv[1], "--batch") == 0) {
+        if (argc >= 5) StartTrace();
+        int result = RunBatchExport(argv[2], argc >= 4 ? atoi(argv[3]) : 0);
+        if (argc >= 5 && !ExportTrace(argv[4])) result = 1;
+        return result;
+    }
+    if (argc == 3 && strcmp(argv[1], "--replay") == 0) {
+        return ReplayInputRecording(argv[2]);
+    }
+
+    Series series = { 0 };
+    const char* seriesFile = (argc == 3 && strcmp(argv[1], "--series") == 0) ? argv[2] : NULL;
+    if (seriesFile && !LoadSeriesFile(seriesFile, &series)) return 1;
+
+    InputRecorder recorder = { 0 };
+    if (argc == 3 && strcmp(argv[1], "--record") == 0 && !StartInputRecording(&recorder, argv[2])) {
+        return 1;
+    }
+
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Wykres funkcji");
+    LoadTextAtlas();
+    if (!LoadGpuCurves()) TraceLog(LOG_INFO, "GPU curves unavailable, sampling on the CPU");
+
+    GraphSet graphs = CreateGraphSet();
+    Graph* live = SetupGraphs(&graphs);
 
-    Graph graphs[3];
-
-    graphs[0] = CreateGraph((Rectangle) { 50, 50, 500, 350 });
-    graphs[0].title = "Funkcje trygonometryczne";
-    graphs[0].xLabel = "x";
-    graphs[0].yLabel = "y";
-    AddFunctionToGraph(&graphs[0], sinf, RED);
-    AddFunctionToGraph(&graphs[0], cosf, BLUE);
-
-    graphs[1] = CreateGraph((Rectangle) { 650, 50, 500, 350 });
-    graphs[1].title = "Wykres Tan(x)";
-    graphs[1].xLabel = "x";
-    graphs[1].yLabel = "y";
-    graphs[1].yMin = -5;
-    graphs[1].yMax = 5;
-    AddFunctionToGraph(&graphs[1], tanf, GREEN);
-
-    graphs[2] = CreateGraph((Rectangle) { 350, 500, 500, 350 });
-    graphs[2].title = "Wykres e^x";
-    graphs[2].xLabel = "x";
-    graphs[2].yLabel = "y";
-    graphs[2].xMin = -5;
-    graphs[2].xMax = 5;
-    graphs[2].yMin = -2;
-    graphs[2].yMax = 10;
-    AddFunctionToGraph(&graphs[2], expFunction, PURPLE);
+    StreamProducer producer = { NULL, 1 };
+    Thread producerThread = { 0 };
+
+    if (seriesFile) ShowSeries(live, &series, seriesFile);
+    else producer.stream = CreateStreamSeries(1 << 20, 10.0, 4096);
+
+    if (producer.stream) {
+        AttachStreamToGraph(live, producer.stream, ORANGE);
+        StartThread(&producerThread, ProduceStreamSamples, &producer);
+    }
 
     while (!WindowShouldClose()) {
+        if (IsKeyPressed(KEY_F3)) ToggleProfiler();
+        if (IsKeyPressed(KEY_F4)) {
+            if (traceEnabled) StopTrace();
+            else StartTrace();
+        }
+        if (IsKeyPressed(KEY_F5)) ExportTrace(TRACE_FILE);
+        if (IsKeyPressed(KEY_F6)) {
+            for (int i = 0; i < graphs.count; i++) graphs.graphs[i]->showStats = !graphs.graphs[i]->showStats;
+        }
+        if (IsKeyPressed(KEY_F7)) ToggleGpuCurves();
+        if (IsKeyPressed(KEY_F8)) {
+            for (int i = 0; i < graphs.count; i++) SetGraphAnalysis(graphs.graphs[i], !graphs.graphs[i]->analysis);
+        }
+
+        InputState input = ReadInputState();
+        RecordInputState(&recorder, &input);
+
+        TraceBegin("frame", -1, -1);
         BeginDrawing();
         ClearBackground(RAYWHITE);
 
-        for (int i = 0; i < 3; i++) {
-            UpdateGraph(&graphs[i]);
-            DrawGraph(&graphs[i]);
+        UpdateGraphSetLayout(&graphs);
+        int hovered = HitTestGraphSet(&graphs, input.mouse);
+        CullGraphSet(&graphs, (Rectangle) { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() }, CULL_MARGIN);
+
+        // All updates go first so a linked axis moved this frame reaches every graph
+        for (int i = 0; i < graphs.count; i++) {
+            ProfilerSetGraph(i);
+            if (i == hovered || graphs.graphs[i]->streamCount > 0) UpdateGraphWithInput(graphs.graphs[i], &input);
         }
+        DrawGraphSet(&graphs, NULL);
 
-        DrawText("sin(x)", 60, 420, 12, RED);
-        DrawText("cos(x)", 120, 420, 12, BLUE);
+        Canvas window = { NULL };
+        DrawLegend(&window);
+        DrawTextBatch();
+        DrawProfilerOverlay(10, 10);
 
         EndDrawing();
+        TraceEnd("frame", -1, -1, 0);
+        ProfilerEndFrame();
     }
 
-    for (int i = 0; i < 3; i++) {
-        UnloadGraph(&graphs[i]);
-    }
+    StopInputRecording(&recorder);
+    AtomicStoreRelease(&producer.running, 0);
+    if (producerThread.handle) JoinThread(&producerThread);
+
+    UnloadGraphSet(&graphs);
+    UnloadStreamSeries(producer.stream);
+    UnloadSeries(&series);
 
+    UnloadGpuCurves();
+    UnloadTextAtlas();
     CloseWindow();
     return 0;
 }
\ No newline at end of file
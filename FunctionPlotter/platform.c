@@ -0,0 +1,292 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "platform.h"
+#include <stdlib.h>
+
+// GL_RENDERER from gl.h, which is not included here
+#define GL_RENDERER_NAME 0x1F01
+
+typedef struct {
+    ThreadProc proc;
+    void* arg;
+} ThreadStart;
+
+#if defined(_WIN32)
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+bool MapFileReadOnly(const char* path, MappedFile* file) {
+    *file = (MappedFile){ 0 };
+
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+        CloseHandle(handle);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+    if (!mapping) return false;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    file->data = view;
+    file->size = (size_t)size.QuadPart;
+    file->handle = mapping;
+    return true;
+}
+
+void UnmapFile(MappedFile* file) {
+    if (file->data) UnmapViewOfFile(file->data);
+    if (file->handle) CloseHandle(file->handle);
+    *file = (MappedFile){ 0 };
+}
+
+static DWORD WINAPI ThreadEntry(LPVOID param) {
+    ThreadStart start = *(ThreadStart*)param;
+    free(param);
+    start.proc(start.arg);
+    return 0;
+}
+
+bool StartThread(Thread* thread, ThreadProc proc, void* arg) {
+    ThreadStart* start = malloc(sizeof(ThreadStart));
+    if (!start) return false;
+    *start = (ThreadStart){ proc, arg };
+
+    thread->handle = CreateThread(NULL, 0, ThreadEntry, start, 0, NULL);
+    if (!thread->handle) {
+        free(start);
+        return false;
+    }
+    return true;
+}
+
+void JoinThread(Thread* thread) {
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+}
+
+int GetProcessorCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+
+bool InitMutex(Mutex* mutex) {
+    mutex->handle = malloc(sizeof(SRWLOCK));
+    if (!mutex->handle) return false;
+    InitializeSRWLock(mutex->handle);
+    return true;
+}
+
+void LockMutex(Mutex* mutex) {
+    AcquireSRWLockExclusive(mutex->handle);
+}
+
+void UnlockMutex(Mutex* mutex) {
+    ReleaseSRWLockExclusive(mutex->handle);
+}
+
+void DestroyMutex(Mutex* mutex) {
+    free(mutex->handle);
+    mutex->handle = NULL;
+}
+
+bool InitCondition(Condition* condition) {
+    condition->handle = malloc(sizeof(CONDITION_VARIABLE));
+    if (!condition->handle) return false;
+    InitializeConditionVariable(condition->handle);
+    return true;
+}
+
+void WaitCondition(Condition* condition, Mutex* mutex) {
+    SleepConditionVariableSRW(condition->handle, mutex->handle, INFINITE, 0);
+}
+
+void SignalCondition(Condition* condition) {
+    WakeConditionVariable(condition->handle);
+}
+
+void DestroyCondition(Condition* condition) {
+    free(condition->handle);
+    condition->handle = NULL;
+}
+
+void SleepMilliseconds(int ms) {
+    Sleep((DWORD)ms);
+}
+
+double GetHighResTime(void) {
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+
+const char* GetGlRendererName(void) {
+    typedef const unsigned char* (WINAPI* GetStringProc)(unsigned int name);
+    HMODULE gl = GetModuleHandleA("opengl32.dll");
+    GetStringProc getString = gl ? (GetStringProc)(void*)GetProcAddress(gl, "glGetString") : NULL;
+    return getString ? (const char*)getString(GL_RENDERER_NAME) : NULL;
+}
+
+#else
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+
+bool MapFileReadOnly(const char* path, MappedFile* file) {
+    *file = (MappedFile){ 0 };
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    file->data = view;
+    file->size = (size_t)st.st_size;
+    return true;
+}
+
+void UnmapFile(MappedFile* file) {
+    if (file->data) munmap((void*)file->data, file->size);
+    *file = (MappedFile){ 0 };
+}
+
+static void* ThreadEntry(void* param) {
+    ThreadStart start = *(ThreadStart*)param;
+    free(param);
+    start.proc(start.arg);
+    return NULL;
+}
+
+bool StartThread(Thread* thread, ThreadProc proc, void* arg) {
+    ThreadStart* start = malloc(sizeof(ThreadStart));
+    pthread_t* handle = malloc(sizeof(pthread_t));
+    if (!start || !handle) {
+        free(start);
+        free(handle);
+        return false;
+    }
+    *start = (ThreadStart){ proc, arg };
+
+    if (pthread_create(handle, NULL, ThreadEntry, start) != 0) {
+        free(start);
+        free(handle);
+        return false;
+    }
+    thread->handle = handle;
+    return true;
+}
+
+void JoinThread(Thread* thread) {
+    pthread_join(*(pthread_t*)thread->handle, NULL);
+    free(thread->handle);
+    thread->handle = NULL;
+}
+
+int GetProcessorCount(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+bool InitMutex(Mutex* mutex) {
+    mutex->handle = malloc(sizeof(pthread_mutex_t));
+    if (!mutex->handle) return false;
+    if (pthread_mutex_init(mutex->handle, NULL) != 0) {
+        free(mutex->handle);
+        mutex->handle = NULL;
+        return false;
+    }
+    return true;
+}
+
+void LockMutex(Mutex* mutex) {
+    pthread_mutex_lock(mutex->handle);
+}
+
+void UnlockMutex(Mutex* mutex) {
+    pthread_mutex_unlock(mutex->handle);
+}
+
+void DestroyMutex(Mutex* mutex) {
+    if (mutex->handle) pthread_mutex_destroy(mutex->handle);
+    free(mutex->handle);
+    mutex->handle = NULL;
+}
+
+bool InitCondition(Condition* condition) {
+    condition->handle = malloc(sizeof(pthread_cond_t));
+    if (!condition->handle) return false;
+    if (pthread_cond_init(condition->handle, NULL) != 0) {
+        free(condition->handle);
+        condition->handle = NULL;
+        return false;
+    }
+    return true;
+}
+
+void WaitCondition(Condition* condition, Mutex* mutex) {
+    pthread_cond_wait(condition->handle, mutex->handle);
+}
+
+void SignalCondition(Condition* condition) {
+    pthread_cond_signal(condition->handle);
+}
+
+void DestroyCondition(Condition* condition) {
+    if (condition->handle) pthread_cond_destroy(condition->handle);
+    free(condition->handle);
+    condition->handle = NULL;
+}
+
+void SleepMilliseconds(int ms) {
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+double GetHighResTime(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+const char* GetGlRendererName(void) {
+    typedef const unsigned char* (*GetStringProc)(unsigned int name);
+    void* process = dlopen(NULL, RTLD_LAZY);
+    if (!process) return NULL;
+
+    GetStringProc getString;
+    *(void**)&getString = dlsym(process, "glGetString");
+    const char* name = getString ? (const char*)getString(GL_RENDERER_NAME) : NULL;
+    dlclose(process);
+    return name;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// OS services kept out of raylib translation units (windows.h clashes with raylib.h)
+
+typedef struct {
+    const void* data;
+    size_t size;
+    void* handle;
+} MappedFile;
+
+typedef void (*ThreadProc)(void* arg);
+
+typedef struct {
+    void* handle;
+} Thread;
+
+typedef struct {
+    void* handle;
+} Mutex;
+
+typedef struct {
+    void* handle;
+} Condition;
+
+bool MapFileReadOnly(const char* path, MappedFile* file);
+void UnmapFile(MappedFile* file);
+
+bool StartThread(Thread* thread, ThreadProc proc, void* arg);
+void JoinThread(Thread* thread);
+int GetProcessorCount(void);
+
+bool InitMutex(Mutex* mutex);
+void LockMutex(Mutex* mutex);
+void UnlockMutex(Mutex* mutex);
+void DestroyMutex(Mutex* mutex);
+
+bool InitCondition(Condition* condition);
+// Releases mutex while waiting and holds it again on return; wakeups can be spurious
+void WaitCondition(Condition* condition, Mutex* mutex);
+void SignalCondition(Condition* condition);
+void DestroyCondition(Condition* condition);
+void SleepMilliseconds(int ms);
+double GetHighResTime(void);
+// GL_RENDERER of the current context, looked up in the loaded GL library; NULL if unavailable
+const char* GetGlRendererName(void);
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+#define THREAD_LOCAL __declspec(thread)
+
+static inline size_t AtomicLoadAcquire(const volatile size_t* p) {
+    size_t value = *p;
+    _ReadWriteBarrier();
+    return value;
+}
+
+static inline void AtomicStoreRelease(volatile size_t* p, size_t value) {
+    _ReadWriteBarrier();
+    *p = value;
+}
+
+static inline size_t AtomicFetchAdd(volatile size_t* p, size_t value) {
+#if defined(_WIN64)
+    return (size_t)_InterlockedExchangeAdd64((volatile __int64*)p, (__int64)value);
+#else
+    return (size_t)_InterlockedExchangeAdd((volatile long*)p, (long)value);
+#endif
+}
+#else
+#define THREAD_LOCAL _Thread_local
+
+static inline size_t AtomicLoadAcquire(const volatile size_t* p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void AtomicStoreRelease(volatile size_t* p, size_t value) {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+static inline size_t AtomicFetchAdd(volatile size_t* p, size_t value) {
+    return __atomic_fetch_add(p, value, __ATOMIC_ACQ_REL);
+}
+#endif
+
+#endif
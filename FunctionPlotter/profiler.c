@@ -0,0 +1,148 @@
+#include "profiler.h"
+#include "platform.h"
+#include "raylib.h"
+#include "canvas.h"
+#include "textbatch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROFILER_ROW_HEIGHT 14
+#define PROFILER_BAR_SCALE 100.0f
+
+typedef struct {
+    double frameTotal;
+    bool used;
+    float history[PROFILER_HISTORY];
+} ProfileSlot;
+
+bool profilerEnabled = false;
+
+static ProfileSlot slots[PROFILER_MAX_GRAPHS][PROFILER_MAX_FUNCTIONS + 1][PROFILE_STAGE_COUNT];
+static ProfileSlot frameSlot;
+static THREAD_LOCAL int currentGraph = 0;
+static int historyIndex = 0;
+static int historyCount = 0;
+static double lastFrame = 0;
+
+static const char* stageNames[PROFILE_STAGE_COUNT] = { "update", "axes", "eval", "submit" };
+
+void ProfilerSetGraph(int graphIndex) {
+    currentGraph = graphIndex;
+}
+
+ProfileScope ProfilerBegin(ProfileStage stage, int functionIndex) {
+    TraceBegin(stageNames[stage], currentGraph, functionIndex);
+    return (ProfileScope){ GetHighResTime(), stage, functionIndex };
+}
+
+void ProfilerEnd(const ProfileScope* scope, int sampleCount) {
+    double seconds = GetHighResTime() - scope->start;
+    TraceEnd(stageNames[scope->stage], currentGraph, scope->functionIndex, sampleCount);
+
+    if (!profilerEnabled) return;
+    if (currentGraph < 0 || currentGraph >= PROFILER_MAX_GRAPHS) return;
+    if (scope->functionIndex < -1 || scope->functionIndex >= PROFILER_MAX_FUNCTIONS) return;
+
+    ProfileSlot* slot = &slots[currentGraph][scope->functionIndex + 1][scope->stage];
+    slot->frameTotal += seconds;
+    slot->used = true;
+}
+
+static void PushSlot(ProfileSlot* slot) {
+    slot->history[historyIndex] = (float)(slot->frameTotal * 1000.0);
+    slot->frameTotal = 0;
+}
+
+void ProfilerEndFrame(void) {
+    double now = GetHighResTime();
+    if (!profilerEnabled) {
+        lastFrame = 0;
+        return;
+    }
+
+    if (lastFrame != 0) {
+        frameSlot.frameTotal = now - lastFrame;
+        frameSlot.used = true;
+    }
+    lastFrame = now;
+
+    PushSlot(&frameSlot);
+    for (int g = 0; g < PROFILER_MAX_GRAPHS; g++) {
+        for (int f = 0; f <= PROFILER_MAX_FUNCTIONS; f++) {
+            for (int s = 0; s < PROFILE_STAGE_COUNT; s++) {
+                if (slots[g][f][s].used) PushSlot(&slots[g][f][s]);
+            }
+        }
+    }
+    historyIndex = (historyIndex + 1) % PROFILER_HISTORY;
+    if (historyCount < PROFILER_HISTORY) historyCount++;
+}
+
+void ToggleProfiler(void) {
+    profilerEnabled = !profilerEnabled;
+    if (profilerEnabled) memset(slots, 0, sizeof(slots));
+    memset(&frameSlot, 0, sizeof(frameSlot));
+    historyIndex = 0;
+    historyCount = 0;
+}
+
+static int CompareFloats(const void* a, const void* b) {
+    float fa = *(const float*)a, fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static void GetPercentiles(const ProfileSlot* slot, float* p50, float* p99) {
+    float sorted[PROFILER_HISTORY];
+    int count = historyCount > 0 ? historyCount : 1;
+    memcpy(sorted, slot->history, sizeof(float) * count);
+    qsort(sorted, count, sizeof(float), CompareFloats);
+    *p50 = sorted[count / 2];
+    *p99 = sorted[count * 99 / 100];
+}
+
+static void DrawProfileRow(const char* label, const ProfileSlot* slot, int x, int y) {
+    float p50, p99;
+    GetPercentiles(slot, &p50, &p99);
+
+    char text[96];
+    snprintf(text, sizeof(text), "%-14s p50 %6.3f  p99 %6.3f ms", label, p50, p99);
+    Canvas window = { NULL };
+    CanvasText(&window, text, x, y, 10, RAYWHITE);
+
+    int barX = x + 230;
+    DrawRectangle(barX, y + 1, (int)(p99 * PROFILER_BAR_SCALE), 8, Fade(ORANGE, 0.5f));
+    DrawRectangle(barX, y + 1, (int)(p50 * PROFILER_BAR_SCALE), 8, LIME);
+}
+
+void DrawProfilerOverlay(int x, int y) {
+    if (!profilerEnabled) return;
+
+    int rows = 1;
+    for (int g = 0; g < PROFILER_MAX_GRAPHS; g++) {
+        for (int f = 0; f <= PROFILER_MAX_FUNCTIONS; f++) {
+            for (int s = 0; s < PROFILE_STAGE_COUNT; s++) {
+                if (slots[g][f][s].used) rows++;
+            }
+        }
+    }
+
+    DrawRectangle(x, y, 420, rows * PROFILER_ROW_HEIGHT + 10, Fade(BLACK, 0.75f));
+    y += 5;
+    DrawProfileRow("frame", &frameSlot, x + 5, y);
+    y += PROFILER_ROW_HEIGHT;
+
+    char label[32];
+    for (int g = 0; g < PROFILER_MAX_GRAPHS; g++) {
+        for (int f = 0; f <= PROFILER_MAX_FUNCTIONS; f++) {
+            for (int s = 0; s < PROFILE_STAGE_COUNT; s++) {
+                if (!slots[g][f][s].used) continue;
+                if (f == 0) snprintf(label, sizeof(label), "g%d %s", g, stageNames[s]);
+                else snprintf(label, sizeof(label), "g%d f%d %s", g, f - 1, stageNames[s]);
+                DrawProfileRow(label, &slots[g][f][s], x + 5, y);
+                y += PROFILER_ROW_HEIGHT;
+            }
+        }
+    }
+    DrawTextBatch();
+}
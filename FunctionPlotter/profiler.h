@@ -0,0 +1,47 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include "trace.h"
+
+#define PROFILER_MAX_GRAPHS 16
+#define PROFILER_MAX_FUNCTIONS 8
+#define PROFILER_HISTORY 240
+
+typedef enum {
+    PROFILE_UPDATE,
+    PROFILE_AXES,
+    PROFILE_EVALUATE,
+    PROFILE_SUBMIT,
+    PROFILE_STAGE_COUNT
+} ProfileStage;
+
+typedef struct {
+    double start;
+    ProfileStage stage;
+    int functionIndex;
+} ProfileScope;
+
+extern bool profilerEnabled;
+
+// Scopes feed both the overlay and the trace buffer and are a single branch
+// when both are off; define FUNCTIONPLOTTER_NO_PROFILER to compile them out
+#ifndef FUNCTIONPLOTTER_NO_PROFILER
+#define PROFILE_BEGIN(name, stage, function) \
+    ProfileScope name = (profilerEnabled || traceEnabled) ? ProfilerBegin(stage, function) : (ProfileScope){ 0 }
+#define PROFILE_END(name, samples) \
+    if (name.start != 0.0) ProfilerEnd(&name, samples)
+#else
+#define PROFILE_BEGIN(name, stage, function) (void)0
+#define PROFILE_END(name, samples) (void)0
+#endif
+
+// The current graph is per thread so batch workers can tag their own events
+void ProfilerSetGraph(int graphIndex);
+ProfileScope ProfilerBegin(ProfileStage stage, int functionIndex);
+void ProfilerEnd(const ProfileScope* scope, int sampleCount);
+void ProfilerEndFrame(void);
+void ToggleProfiler(void);
+void DrawProfilerOverlay(int x, int y);
+
+#endif
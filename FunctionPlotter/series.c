@@ -0,0 +1,254 @@
+#include "series.h"
+#include "platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+Series CreateSeries(const double* x, const double* y, size_t count) {
+    Series s = { 0 };
+    double* data = malloc(sizeof(double) * count * 2);
+    if (!data) return s;
+
+    memcpy(data, x, sizeof(double) * count);
+    memcpy(data + count, y, sizeof(double) * count);
+
+    s.count = count;
+    s.x = data;
+    s.y = data + count;
+    s.data = data;
+    BuildSeriesPyramid(&s);
+    return s;
+}
+
+void BuildSeriesPyramid(Series* series) {
+    free(series->pyramid);
+    free(series->levels);
+    series->pyramid = NULL;
+    series->levels = NULL;
+    series->levelCount = 0;
+
+    size_t total = 0;
+    int levelCount = 0;
+    for (size_t n = series->count; n > 1; n = (n + 1) / 2) {
+        total += (n + 1) / 2;
+        levelCount++;
+    }
+    if (levelCount == 0) return;
+
+    double* pyramid = malloc(sizeof(double) * total * 2);
+    SeriesLevel* levels = malloc(sizeof(SeriesLevel) * levelCount);
+    if (!pyramid || !levels) {
+        free(pyramid);
+        free(levels);
+        return;
+    }
+
+    const double* srcMin = series->y;
+    const double* srcMax = series->y;
+    size_t srcCount = series->count;
+    double* out = pyramid;
+
+    for (int k = 0; k < levelCount; k++) {
+        size_t count = (srcCount + 1) / 2;
+        double* minY = out;
+        double* maxY = out + count;
+        out += count * 2;
+
+        for (size_t i = 0; i < srcCount / 2; i++) {
+            minY[i] = fmin(srcMin[2 * i], srcMin[2 * i + 1]);
+            maxY[i] = fmax(srcMax[2 * i], srcMax[2 * i + 1]);
+        }
+        if (srcCount & 1) {
+            minY[count - 1] = srcMin[srcCount - 1];
+            maxY[count - 1] = srcMax[srcCount - 1];
+        }
+
+        levels[k] = (SeriesLevel){ count, minY, maxY };
+        srcMin = minY;
+        srcMax = maxY;
+        srcCount = count;
+    }
+
+    series->pyramid = pyramid;
+    series->levels = levels;
+    series->levelCount = levelCount;
+}
+
+const SeriesLevel* GetSeriesLevel(const Series* series, int level) {
+    if (level < 1 || level > series->levelCount) return NULL;
+    return &series->levels[level - 1];
+}
+
+size_t FindSeriesIndex(const Series* series, double x) {
+    size_t lo = 0, hi = series->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (series->x[mid] < x) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Bottom-up segment tree walk over the pyramid: O(log n) for any [first, last)
+bool GetSeriesRange(const Series* series, size_t first, size_t last, double* minY, double* maxY) {
+    double lo = INFINITY, hi = -INFINITY;
+    if (last > series->count) last = series->count;
+
+    const double* levelMin = series->y;
+    const double* levelMax = series->y;
+    for (int k = 0; first < last; k++) {
+        if (first & 1) {
+            lo = fmin(lo, levelMin[first]);
+            hi = fmax(hi, levelMax[first]);
+            first++;
+        }
+        if (last & 1) {
+            last--;
+            lo = fmin(lo, levelMin[last]);
+            hi = fmax(hi, levelMax[last]);
+        }
+        first >>= 1;
+        last >>= 1;
+        if (first >= last) break;
+
+        const SeriesLevel* level = GetSeriesLevel(series, k + 1);
+        if (!level) return false;
+        levelMin = level->minY;
+        levelMax = level->maxY;
+    }
+
+    if (!(lo <= hi)) return false;
+    *minY = lo;
+    *maxY = hi;
+    return true;
+}
+
+static bool ValidSection(const MappedFile* file, uint64_t offset, uint64_t count) {
+    return offset % sizeof(double) == 0 && offset <= file->size &&
+        count <= (file->size - offset) / sizeof(double);
+}
+
+// Range queries index level k with counts derived from the point count, so an
+// embedded pyramid must have exactly the levels BuildSeriesPyramid would make
+static bool MatchesPyramidShape(const SeriesFileLevel* table, uint32_t levelCount, uint64_t count) {
+    uint32_t k = 0;
+    for (uint64_t n = count; n > 1; n = (n + 1) / 2, k++) {
+        if (k >= levelCount || table[k].count != (n + 1) / 2) return false;
+    }
+    return k == levelCount;
+}
+
+Series LoadSeries(const char* fileName) {
+    Series s = { 0 };
+    MappedFile* file = malloc(sizeof(MappedFile));
+    if (!file || !MapFileReadOnly(fileName, file)) {
+        free(file);
+        return s;
+    }
+
+    const unsigned char* base = file->data;
+    const SeriesFileHeader* header = file->data;
+    bool valid = file->size >= sizeof(SeriesFileHeader) &&
+        memcmp(header->magic, SERIES_FILE_MAGIC, 8) == 0 &&
+        header->version == SERIES_FILE_VERSION &&
+        ValidSection(file, header->xOffset, header->count) &&
+        ValidSection(file, header->yOffset, header->count);
+
+    SeriesLevel* levels = NULL;
+    if (valid && header->levelCount > 0) {
+        uint64_t tableSize = (uint64_t)header->levelCount * sizeof(SeriesFileLevel);
+        valid = header->levelCount <= 64 && header->levelsOffset % 8 == 0 &&
+            header->levelsOffset <= file->size && tableSize <= file->size - header->levelsOffset;
+
+        // A pyramid of the wrong shape is ignored and rebuilt from y
+        const SeriesFileLevel* table = (const SeriesFileLevel*)(base + header->levelsOffset);
+        if (valid && MatchesPyramidShape(table, header->levelCount, header->count)) {
+            levels = malloc(sizeof(SeriesLevel) * header->levelCount);
+        }
+
+        for (uint32_t k = 0; valid && levels && k < header->levelCount; k++) {
+            valid = ValidSection(file, table[k].minOffset, table[k].count) &&
+                ValidSection(file, table[k].maxOffset, table[k].count);
+            if (valid) {
+                levels[k] = (SeriesLevel){
+                    (size_t)table[k].count,
+                    (const double*)(base + table[k].minOffset),
+                    (const double*)(base + table[k].maxOffset)
+                };
+            }
+        }
+    }
+
+    if (!valid) {
+        free(levels);
+        UnmapFile(file);
+        free(file);
+        return s;
+    }
+
+    s.count = (size_t)header->count;
+    s.x = (const double*)(base + header->xOffset);
+    s.y = (const double*)(base + header->yOffset);
+    s.mapping = file;
+
+    if (levels) {
+        s.levels = levels;
+        s.levelCount = (int)header->levelCount;
+    }
+    else {
+        BuildSeriesPyramid(&s);
+    }
+    return s;
+}
+
+static bool WriteColumn(FILE* out, const double* values, size_t count) {
+    return fwrite(values, sizeof(double), count, out) == count;
+}
+
+bool ExportSeries(const Series* series, const char* fileName, bool withPyramid) {
+    FILE* out = fopen(fileName, "wb");
+    if (!out) return false;
+
+    int levelCount = withPyramid ? series->levelCount : 0;
+    uint64_t columnSize = (uint64_t)series->count * sizeof(double);
+
+    SeriesFileHeader header = { 0 };
+    memcpy(header.magic, SERIES_FILE_MAGIC, 8);
+    header.version = SERIES_FILE_VERSION;
+    header.levelCount = (uint32_t)levelCount;
+    header.count = series->count;
+    header.xOffset = sizeof(SeriesFileHeader);
+    header.yOffset = header.xOffset + columnSize;
+    header.levelsOffset = levelCount > 0 ? header.yOffset + columnSize : 0;
+
+    bool ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+        WriteColumn(out, series->x, series->count) &&
+        WriteColumn(out, series->y, series->count);
+
+    uint64_t offset = header.levelsOffset + (uint64_t)levelCount * sizeof(SeriesFileLevel);
+    for (int k = 0; ok && k < levelCount; k++) {
+        uint64_t size = (uint64_t)series->levels[k].count * sizeof(double);
+        SeriesFileLevel entry = { series->levels[k].count, offset, offset + size };
+        ok = fwrite(&entry, sizeof(entry), 1, out) == 1;
+        offset += size * 2;
+    }
+    for (int k = 0; ok && k < levelCount; k++) {
+        ok = WriteColumn(out, series->levels[k].minY, series->levels[k].count) &&
+            WriteColumn(out, series->levels[k].maxY, series->levels[k].count);
+    }
+
+    if (fclose(out) != 0) ok = false;
+    return ok;
+}
+
+void UnloadSeries(Series* series) {
+    if (series->mapping) {
+        UnmapFile(series->mapping);
+        free(series->mapping);
+    }
+    free(series->data);
+    free(series->pyramid);
+    free(series->levels);
+    *series = (Series){ 0 };
+}
@@ -0,0 +1,60 @@
+#ifndef SERIES_H
+#define SERIES_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Binary series file (little-endian, every offset 8-byte aligned):
+//   SeriesFileHeader
+//   double x[count], double y[count]
+//   SeriesFileLevel table[levelCount] followed by each level's min and max arrays
+#define SERIES_FILE_MAGIC "WYKRSER1"
+#define SERIES_FILE_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t levelCount;
+    uint64_t count;
+    uint64_t xOffset;
+    uint64_t yOffset;
+    uint64_t levelsOffset;
+    uint64_t reserved[2];
+} SeriesFileHeader;
+
+typedef struct {
+    uint64_t count;
+    uint64_t minOffset;
+    uint64_t maxOffset;
+} SeriesFileLevel;
+
+// Level k of the pyramid stores min/max of y over buckets of 2^k consecutive points
+typedef struct {
+    size_t count;
+    const double* minY;
+    const double* maxY;
+} SeriesLevel;
+
+// Sampled data with x sorted ascending
+typedef struct {
+    size_t count;
+    const double* x;
+    const double* y;
+    int levelCount;
+    SeriesLevel* levels;
+    void* data;
+    void* pyramid;
+    void* mapping;
+} Series;
+
+Series CreateSeries(const double* x, const double* y, size_t count);
+void BuildSeriesPyramid(Series* series);
+const SeriesLevel* GetSeriesLevel(const Series* series, int level);
+size_t FindSeriesIndex(const Series* series, double x);
+bool GetSeriesRange(const Series* series, size_t first, size_t last, double* minY, double* maxY);
+Series LoadSeries(const char* fileName);
+bool ExportSeries(const Series* series, const char* fileName, bool withPyramid);
+void UnloadSeries(Series* series);
+
+#endif
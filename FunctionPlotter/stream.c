@@ -0,0 +1,127 @@
+#include "stream.h"
+#include "platform.h"
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+
+StreamSeries* CreateStreamSeries(size_t capacity, double history, int columnCount) {
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+
+    StreamSeries* stream = calloc(1, sizeof(StreamSeries));
+    if (!stream) return NULL;
+
+    stream->ring = malloc(sizeof(StreamSample) * size);
+    stream->columns = malloc(sizeof(StreamColumn) * columnCount);
+    if (!stream->ring || !stream->columns) {
+        UnloadStreamSeries(stream);
+        return NULL;
+    }
+
+    stream->mask = size - 1;
+    stream->history = history;
+    stream->columnCount = columnCount;
+    stream->columnWidth = history / columnCount;
+    for (int i = 0; i < columnCount; i++) {
+        stream->columns[i] = (StreamColumn){ LLONG_MIN, INFINITY, -INFINITY };
+    }
+    return stream;
+}
+
+bool PushStreamSample(StreamSeries* stream, double x, double y) {
+    StreamSample sample = { x, y };
+    return PushStreamSamples(stream, &sample, 1) == 1;
+}
+
+size_t PushStreamSamples(StreamSeries* stream, const StreamSample* samples, size_t count) {
+    size_t head = stream->head;
+    size_t tail = AtomicLoadAcquire(&stream->tail);
+    size_t space = stream->mask + 1 - (head - tail);
+
+    if (count > space) {
+        stream->dropped += count - space;
+        count = space;
+    }
+    for (size_t i = 0; i < count; i++) {
+        stream->ring[(head + i) & stream->mask] = samples[i];
+    }
+    AtomicStoreRelease(&stream->head, head + count);
+    return count;
+}
+
+static StreamColumn* ColumnSlot(const StreamSeries* stream, long long index) {
+    long long slot = index % stream->columnCount;
+    return &stream->columns[slot < 0 ? slot + stream->columnCount : slot];
+}
+
+static void AddToColumns(StreamSeries* stream, double x, double y) {
+    long long index = (long long)floor(x / stream->columnWidth);
+
+    if (!stream->hasData || index > stream->newestColumn) {
+        if (!stream->hasData) stream->newestX = x;
+        long long first = stream->hasData ? stream->newestColumn + 1 : index;
+        if (index - first >= stream->columnCount) first = index - stream->columnCount + 1;
+        for (long long i = first; i <= index; i++) {
+            *ColumnSlot(stream, i) = (StreamColumn){ i, INFINITY, -INFINITY };
+        }
+        stream->newestColumn = index;
+        stream->hasData = true;
+    }
+    else if (index <= stream->newestColumn - stream->columnCount) {
+        return;
+    }
+
+    if (x > stream->newestX) stream->newestX = x;
+    if (!isfinite(y)) return;
+
+    StreamColumn* column = ColumnSlot(stream, index);
+    if (y < column->minY) column->minY = y;
+    if (y > column->maxY) column->maxY = y;
+}
+
+size_t DrainStreamSeries(StreamSeries* stream) {
+    size_t tail = stream->tail;
+    size_t head = AtomicLoadAcquire(&stream->head);
+
+    for (size_t i = tail; i != head; i++) {
+        const StreamSample* sample = &stream->ring[i & stream->mask];
+        AddToColumns(stream, sample->x, sample->y);
+    }
+    AtomicStoreRelease(&stream->tail, head);
+    return head - tail;
+}
+
+const StreamColumn* GetStreamColumn(const StreamSeries* stream, long long index) {
+    if (!stream->hasData || index > stream->newestColumn) return NULL;
+    const StreamColumn* column = ColumnSlot(stream, index);
+    return column->index == index ? column : NULL;
+}
+
+bool GetStreamRange(const StreamSeries* stream, double xMin, double xMax, double* minY, double* maxY) {
+    if (!stream->hasData) return false;
+
+    long long first = (long long)floor(xMin / stream->columnWidth);
+    long long last = (long long)floor(xMax / stream->columnWidth);
+    if (first < stream->newestColumn - stream->columnCount + 1) first = stream->newestColumn - stream->columnCount + 1;
+    if (last > stream->newestColumn) last = stream->newestColumn;
+
+    double lo = INFINITY, hi = -INFINITY;
+    for (long long i = first; i <= last; i++) {
+        const StreamColumn* column = GetStreamColumn(stream, i);
+        if (!column) continue;
+        lo = fmin(lo, column->minY);
+        hi = fmax(hi, column->maxY);
+    }
+
+    if (!(lo <= hi)) return false;
+    *minY = lo;
+    *maxY = hi;
+    return true;
+}
+
+void UnloadStreamSeries(StreamSeries* stream) {
+    if (!stream) return;
+    free(stream->ring);
+    free(stream->columns);
+    free(stream);
+}
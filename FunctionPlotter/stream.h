@@ -0,0 +1,44 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct {
+    double x, y;
+} StreamSample;
+
+typedef struct {
+    long long index;
+    double minY, maxY;
+} StreamColumn;
+
+// Single-producer/single-consumer ring: the producer thread only calls PushStreamSample(s),
+// the render thread drains it once per frame into fixed-width min/max columns
+typedef struct {
+    StreamSample* ring;
+    size_t mask;
+    volatile size_t head;
+    char headPad[64 - sizeof(size_t)];
+    volatile size_t tail;
+    char tailPad[64 - sizeof(size_t)];
+    size_t dropped;
+
+    double history;
+    double columnWidth;
+    int columnCount;
+    StreamColumn* columns;
+    long long newestColumn;
+    double newestX;
+    bool hasData;
+} StreamSeries;
+
+StreamSeries* CreateStreamSeries(size_t capacity, double history, int columnCount);
+bool PushStreamSample(StreamSeries* stream, double x, double y);
+size_t PushStreamSamples(StreamSeries* stream, const StreamSample* samples, size_t count);
+size_t DrainStreamSeries(StreamSeries* stream);
+const StreamColumn* GetStreamColumn(const StreamSeries* stream, long long index);
+bool GetStreamRange(const StreamSeries* stream, double xMin, double xMax, double* minY, double* maxY);
+void UnloadStreamSeries(StreamSeries* stream);
+
+#endif
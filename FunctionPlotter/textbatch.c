@@ -0,0 +1,140 @@
+#include "textbatch.h"
+#include "canvasfont.h"
+#include "rlgl.h"
+#include <stdlib.h>
+
+#define TEXT_ATLAS_PADDING 1
+
+typedef struct {
+    float x, y, width, height;
+    float u0, v0, u1, v1;
+    Color color;
+} TextQuad;
+
+typedef struct {
+    TextQuad* quads;
+    int quadCount;
+    int quadCapacity;
+} TextQueue;
+
+static Texture2D atlas = { 0 };
+static Rectangle glyphRects[CANVAS_FONT_GLYPHS];
+static TextQueue layers[TEXT_LAYER_COUNT];
+static TextLayer currentLayer = TEXT_LAYER_OVERLAY;
+
+static int GlyphIndex(char c) {
+    int index = (unsigned char)c - CANVAS_FONT_FIRST;
+    if (index < 0 || index >= CANVAS_FONT_GLYPHS) index = '?' - CANVAS_FONT_FIRST;
+    return index;
+}
+
+bool LoadTextAtlas(void) {
+    int width = 0;
+    for (int i = 0; i < CANVAS_FONT_GLYPHS; i++) {
+        width += canvasFontGlyphs[i].width + TEXT_ATLAS_PADDING * 2;
+    }
+    int height = CANVAS_FONT_HEIGHT + TEXT_ATLAS_PADDING * 2;
+
+    // White glyphs with coverage in alpha so vertex colors tint them
+    Image image = GenImageColor(width, height, BLANK);
+    unsigned char* pixels = image.data;
+    int penX = TEXT_ATLAS_PADDING;
+
+    for (int i = 0; i < CANVAS_FONT_GLYPHS; i++) {
+        const CanvasGlyph* glyph = &canvasFontGlyphs[i];
+        for (int y = 0; y < CANVAS_FONT_HEIGHT; y++) {
+            for (int x = 0; x < glyph->width; x++) {
+                int bit = glyph->offset + y * glyph->width + x;
+                int nibble = (canvasFontPixels[bit >> 1] >> ((bit & 1) * 4)) & 15;
+                unsigned char* p = pixels + ((size_t)(y + TEXT_ATLAS_PADDING) * width + penX + x) * 4;
+                p[0] = p[1] = p[2] = 255;
+                p[3] = (unsigned char)(nibble * 17);
+            }
+        }
+        glyphRects[i] = (Rectangle){ (float)penX, TEXT_ATLAS_PADDING, glyph->width, CANVAS_FONT_HEIGHT };
+        penX += glyph->width + TEXT_ATLAS_PADDING * 2;
+    }
+
+    atlas = LoadTextureFromImage(image);
+    UnloadImage(image);
+    if (atlas.id == 0) return false;
+
+    SetTextureFilter(atlas, TEXTURE_FILTER_BILINEAR);
+    return true;
+}
+
+void UnloadTextAtlas(void) {
+    if (atlas.id != 0) UnloadTexture(atlas);
+    atlas = (Texture2D){ 0 };
+    for (int i = 0; i < TEXT_LAYER_COUNT; i++) {
+        free(layers[i].quads);
+        layers[i] = (TextQueue){ 0 };
+    }
+}
+
+bool IsTextAtlasReady(void) {
+    return atlas.id != 0;
+}
+
+void SetTextLayer(TextLayer layer) {
+    currentLayer = layer;
+}
+
+void QueueText(const char* text, float x, float y, int fontSize, Color color) {
+    TextQueue* queue = &layers[currentLayer];
+    float scale = (float)fontSize / CANVAS_FONT_HEIGHT;
+
+    for (const char* c = text; *c; c++) {
+        int index = GlyphIndex(*c);
+        const CanvasGlyph* glyph = &canvasFontGlyphs[index];
+
+        if (glyph->width > 0) {
+            if (queue->quadCount == queue->quadCapacity) {
+                int capacity = queue->quadCapacity ? queue->quadCapacity * 2 : 1024;
+                TextQuad* grown = realloc(queue->quads, sizeof(TextQuad) * capacity);
+                if (!grown) return;
+                queue->quads = grown;
+                queue->quadCapacity = capacity;
+            }
+
+            Rectangle r = glyphRects[index];
+            queue->quads[queue->quadCount++] = (TextQuad){
+                x, y, r.width * scale, r.height * scale,
+                r.x / atlas.width, r.y / atlas.height,
+                (r.x + r.width) / atlas.width, (r.y + r.height) / atlas.height,
+                color
+            };
+        }
+        x += glyph->advance * scale;
+    }
+}
+
+void DrawTextLayer(TextLayer layer) {
+    TextQueue* queue = &layers[layer];
+    if (queue->quadCount == 0) return;
+
+    rlSetTexture(atlas.id);
+    rlBegin(RL_QUADS);
+    for (int i = 0; i < queue->quadCount; i++) {
+        const TextQuad* q = &queue->quads[i];
+        rlColor4ub(q->color.r, q->color.g, q->color.b, q->color.a);
+        rlTexCoord2f(q->u0, q->v0);
+        rlVertex2f(q->x, q->y);
+        rlTexCoord2f(q->u0, q->v1);
+        rlVertex2f(q->x, q->y + q->height);
+        rlTexCoord2f(q->u1, q->v1);
+        rlVertex2f(q->x + q->width, q->y + q->height);
+        rlTexCoord2f(q->u1, q->v0);
+        rlVertex2f(q->x + q->width, q->y);
+    }
+    rlEnd();
+    rlSetTexture(0);
+
+    queue->quadCount = 0;
+}
+
+void DrawTextBatch(void) {
+    for (int i = 0; i < TEXT_LAYER_COUNT; i++) {
+        DrawTextLayer((TextLayer)i);
+    }
+}
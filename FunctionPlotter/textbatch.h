@@ -0,0 +1,28 @@
+#ifndef TEXTBATCH_H
+#define TEXTBATCH_H
+
+#include "raylib.h"
+
+// Window text drawn from one atlas texture of the canvas font: strings are
+// queued as quads and submitted together by DrawTextBatch. Needs a GL
+// context, so LoadTextAtlas goes after InitWindow.
+//
+// Text goes under or over what is drawn meanwhile by its layer: axis text is
+// submitted on its own before the curves, everything else once per frame.
+typedef enum {
+    TEXT_LAYER_AXES,
+    TEXT_LAYER_OVERLAY,
+    TEXT_LAYER_COUNT
+} TextLayer;
+
+bool LoadTextAtlas(void);
+void UnloadTextAtlas(void);
+bool IsTextAtlasReady(void);
+// Layer that QueueText adds to, TEXT_LAYER_OVERLAY until changed
+void SetTextLayer(TextLayer layer);
+void QueueText(const char* text, float x, float y, int fontSize, Color color);
+void DrawTextLayer(TextLayer layer);
+// Submits every layer, bottom first
+void DrawTextBatch(void);
+
+#endif
@@ -0,0 +1,212 @@
+#include "tilecache.h"
+#include "diskcache.h"
+#include "platform.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+static Mutex mutex;
+static bool initialized = false;
+static size_t limit = TILE_CACHE_LIMIT;
+static size_t usage = 0;
+static Tile* buckets[TILE_CACHE_BUCKETS];
+static Tile* newest = NULL;
+static Tile* oldest = NULL;
+
+static unsigned int HashTile(FunctionPtr func, int level, long long index) {
+    unsigned long long h = (unsigned long long)((size_t)func >> 4) * 0x9E3779B97F4A7C15ull;
+    h = (h ^ (unsigned int)level) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (unsigned long long)index) * 0x94D049BB133111EBull;
+    return (unsigned int)((h ^ (h >> 31)) % TILE_CACHE_BUCKETS);
+}
+
+static void Unlink(Tile* tile) {
+    if (tile->newer) tile->newer->older = tile->older;
+    else newest = tile->older;
+    if (tile->older) tile->older->newer = tile->newer;
+    else oldest = tile->newer;
+}
+
+static void PushNewest(Tile* tile) {
+    tile->newer = NULL;
+    tile->older = newest;
+    if (newest) newest->newer = tile;
+    else oldest = tile;
+    newest = tile;
+}
+
+static void Evict(Tile* tile) {
+    Tile** link = &buckets[HashTile(tile->func, tile->level, tile->index)];
+    while (*link != tile) link = &(*link)->next;
+    *link = tile->next;
+    Unlink(tile);
+    usage -= sizeof(Tile);
+    free(tile);
+}
+
+// Keeps keep even if it alone is over the limit
+static void EvictToLimit(const Tile* keep) {
+    while (usage > limit && oldest && oldest != keep) Evict(oldest);
+}
+
+bool InitTileCache(size_t cacheLimit) {
+    if (initialized) return true;
+    limit = cacheLimit;
+    initialized = InitMutex(&mutex);
+    return initialized;
+}
+
+void ShutdownTileCache(void) {
+    if (!initialized) return;
+
+    while (oldest) Evict(oldest);
+    DestroyMutex(&mutex);
+    initialized = false;
+}
+
+void SetTileCacheLimit(size_t cacheLimit) {
+    if (!initialized) {
+        limit = cacheLimit;
+        return;
+    }
+    LockMutex(&mutex);
+    limit = cacheLimit;
+    EvictToLimit(NULL);
+    UnlockMutex(&mutex);
+}
+
+size_t GetTileCacheUsage(void) {
+    return usage;
+}
+
+int GetTileLevel(double spacing, double xMin, double xMax) {
+    int level = (spacing > 0 && isfinite(spacing)) ? (int)floor(log2(spacing) + 0.5) : 0;
+    double extent = fmax(fabs(xMin), fabs(xMax));
+    int minLevel = extent > 0 ? ilogb(extent) - 40 : -1000;
+
+    if (level < minLevel) level = minLevel;
+    if (level < -1000) level = -1000;
+    if (level > 1000) level = 1000;
+    return level;
+}
+
+static void EvaluateTile(Tile* tile, FunctionStats* stats) {
+    double spacing = ldexp(1.0, tile->level);
+    long long base = tile->index * TILE_SAMPLES;
+    float lo = INFINITY, hi = -INFINITY;
+    int nonFinite = 0;
+    double start = GetHighResTime();
+
+    for (int i = 0; i < TILE_SAMPLES; i++) {
+        float y = tile->func((float)((base + i) * spacing));
+        tile->samples[i] = y;
+        if (isfinite(y)) {
+            if (y < lo) lo = y;
+            if (y > hi) hi = y;
+        }
+        else nonFinite++;
+    }
+
+    double elapsed = GetHighResTime() - start;
+    float costNs = (float)(elapsed * 1e9 / TILE_SAMPLES);
+    stats->evaluations += TILE_SAMPLES;
+    stats->nonFinite += nonFinite;
+    stats->seconds += elapsed;
+    stats->costNs = stats->costNs > 0 ? stats->costNs * 0.9f + costNs * 0.1f : costNs;
+
+    tile->minY = lo;
+    tile->maxY = hi;
+}
+
+// Copies samples [from, to) of tile; whole tiles use their stored range
+static void CopyTile(const Tile* tile, int from, int to, float* out, float* lo, float* hi) {
+    memcpy(out, tile->samples + from, sizeof(float) * (to - from));
+
+    if (from == 0 && to == TILE_SAMPLES) {
+        if (tile->minY < *lo) *lo = tile->minY;
+        if (tile->maxY > *hi) *hi = tile->maxY;
+        return;
+    }
+    for (int i = from; i < to; i++) {
+        float y = tile->samples[i];
+        if (isfinite(y)) {
+            if (y < *lo) *lo = y;
+            if (y > *hi) *hi = y;
+        }
+    }
+}
+
+static Tile* FindTile(FunctionPtr func, int level, long long index) {
+    Tile* tile = buckets[HashTile(func, level, index)];
+    while (tile && !(tile->func == func && tile->level == level && tile->index == index)) tile = tile->next;
+    return tile;
+}
+
+static long long FloorDiv(long long a, long long b) {
+    long long q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// Missing tiles are evaluated outside the lock, so batch workers never wait on
+// each other's functions; if two race on one tile the first insert wins
+void SampleTiles(FunctionPtr func, int level, long long first, int count,
+    float* samples, float* lo, float* hi, FunctionStats* stats) {
+    *lo = INFINITY;
+    *hi = -INFINITY;
+    long long end = first + count;
+
+    for (long long index = FloorDiv(first, TILE_SAMPLES); index * TILE_SAMPLES < end; index++) {
+        long long base = index * TILE_SAMPLES;
+        int from = first > base ? (int)(first - base) : 0;
+        int to = end < base + TILE_SAMPLES ? (int)(end - base) : TILE_SAMPLES;
+        float* out = samples + (base + from - first);
+
+        if (initialized) {
+            LockMutex(&mutex);
+            Tile* tile = FindTile(func, level, index);
+            if (tile) {
+                Unlink(tile);
+                PushNewest(tile);
+                CopyTile(tile, from, to, out, lo, hi);
+                UnlockMutex(&mutex);
+                continue;
+            }
+            UnlockMutex(&mutex);
+        }
+
+        Tile local;
+        Tile* fresh = initialized ? malloc(sizeof(Tile)) : &local;
+        if (!fresh) {
+            for (int i = from; i < to; i++) out[i - from] = NAN;
+            continue;
+        }
+        *fresh = (Tile){ .func = func, .level = level, .index = index };
+        if (!LoadDiskTile(fresh)) {
+            EvaluateTile(fresh, stats);
+            StoreDiskTile(fresh, stats->costNs);
+        }
+
+        if (!initialized) {
+            CopyTile(fresh, from, to, out, lo, hi);
+            continue;
+        }
+
+        LockMutex(&mutex);
+        Tile* tile = FindTile(func, level, index);
+        if (tile) {
+            free(fresh);
+            Unlink(tile);
+        }
+        else {
+            tile = fresh;
+            Tile** bucket = &buckets[HashTile(func, level, index)];
+            tile->next = *bucket;
+            *bucket = tile;
+            usage += sizeof(Tile);
+        }
+        PushNewest(tile);
+        CopyTile(tile, from, to, out, lo, hi);
+        EvictToLimit(tile);
+        UnlockMutex(&mutex);
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef TILECACHE_H
+#define TILECACHE_H
+
+#include "graph.h"
+
+#define TILE_SAMPLES 128
+#define TILE_CACHE_BUCKETS 4096
+// Default memory cap in bytes
+#define TILE_CACHE_LIMIT (64u * 1024 * 1024)
+
+// TILE_SAMPLES values of func at x = (index * TILE_SAMPLES + i) * 2^level,
+// so tiles of one level line up in world space whatever the viewport
+typedef struct Tile {
+    FunctionPtr func;
+    int level;
+    long long index;
+    float minY, maxY;   // finite range, minY > maxY when there is none
+    struct Tile* next;  // hash chain
+    struct Tile* newer;
+    struct Tile* older;
+    float samples[TILE_SAMPLES];
+} Tile;
+
+// Without InitTileCache every tile is evaluated on request and dropped
+bool InitTileCache(size_t limit);
+void ShutdownTileCache(void);
+// Evicts least recently used tiles until the cache fits
+void SetTileCacheLimit(size_t limit);
+size_t GetTileCacheUsage(void);
+
+// Power-of-two level whose spacing is nearest to spacing, kept coarse enough
+// that grid indices of x in [xMin, xMax] stay exact
+int GetTileLevel(double spacing, double xMin, double xMax);
+// samples[i] = func((first + i) * 2^level); cached tiles are copied, missing
+// ones read from the disk cache or evaluated and counted in stats. lo/hi
+// receive the finite range.
+void SampleTiles(FunctionPtr func, int level, long long first, int count,
+    float* samples, float* lo, float* hi, FunctionStats* stats);
+
+#endif
@@ -0,0 +1,88 @@
+#include "trace.h"
+#include "platform.h"
+#include <stdio.h>
+
+typedef struct {
+    volatile size_t sequence;
+    const char* name;
+    double time;
+    int threadId;
+    int graphIndex;
+    int functionIndex;
+    int sampleCount;
+    char phase;
+} TraceEvent;
+
+bool traceEnabled = false;
+
+static TraceEvent events[TRACE_CAPACITY];
+static volatile size_t traceHead = 0;
+static volatile size_t nextThreadId = 0;
+static double traceStart = 0;
+static THREAD_LOCAL int threadId = 0;
+
+void StartTrace(void) {
+    for (size_t i = 0; i < TRACE_CAPACITY; i++) {
+        AtomicStoreRelease(&events[i].sequence, 0);
+    }
+    AtomicStoreRelease(&traceHead, 0);
+    traceStart = GetHighResTime();
+    traceEnabled = true;
+}
+
+void StopTrace(void) {
+    traceEnabled = false;
+}
+
+static void PushTraceEvent(char phase, const char* name, int graphIndex, int functionIndex, int sampleCount) {
+    if (!threadId) threadId = (int)AtomicFetchAdd(&nextThreadId, 1) + 1;
+
+    size_t index = AtomicFetchAdd(&traceHead, 1);
+    TraceEvent* e = &events[index & (TRACE_CAPACITY - 1)];
+
+    // sequence is index + 1 only while the slot holds a complete event
+    AtomicStoreRelease(&e->sequence, 0);
+    e->name = name;
+    e->time = GetHighResTime();
+    e->threadId = threadId;
+    e->graphIndex = graphIndex;
+    e->functionIndex = functionIndex;
+    e->sampleCount = sampleCount;
+    e->phase = phase;
+    AtomicStoreRelease(&e->sequence, index + 1);
+}
+
+void TraceBegin(const char* name, int graphIndex, int functionIndex) {
+    if (traceEnabled) PushTraceEvent('B', name, graphIndex, functionIndex, 0);
+}
+
+void TraceEnd(const char* name, int graphIndex, int functionIndex, int sampleCount) {
+    if (traceEnabled) PushTraceEvent('E', name, graphIndex, functionIndex, sampleCount);
+}
+
+bool ExportTrace(const char* fileName) {
+    FILE* file = fopen(fileName, "w");
+    if (!file) return false;
+
+    size_t head = AtomicLoadAcquire(&traceHead);
+    size_t first = head > TRACE_CAPACITY ? head - TRACE_CAPACITY : 0;
+    bool separator = false;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (size_t i = first; i < head; i++) {
+        TraceEvent* slot = &events[i & (TRACE_CAPACITY - 1)];
+        if (AtomicLoadAcquire(&slot->sequence) != i + 1) continue;
+
+        TraceEvent e = *slot;
+        if (AtomicLoadAcquire(&slot->sequence) != i + 1) continue;
+
+        fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d",
+            separator ? "," : "", e.name, e.phase, (e.time - traceStart) * 1e6, e.threadId);
+        fprintf(file, ",\"args\":{\"graph\":%d,\"function\":%d,\"samples\":%d}}",
+            e.graphIndex, e.functionIndex, e.sampleCount);
+        separator = true;
+    }
+    fprintf(file, "\n]}\n");
+
+    return fclose(file) == 0;
+}
@@ -0,0 +1,18 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+
+// Events live in a fixed ring; once it wraps the oldest ones are overwritten
+#define TRACE_CAPACITY (1 << 16)
+
+extern bool traceEnabled;
+
+void StartTrace(void);
+void StopTrace(void);
+void TraceBegin(const char* name, int graphIndex, int functionIndex);
+void TraceEnd(const char* name, int graphIndex, int functionIndex, int sampleCount);
+// Writes the buffered events as Chrome Trace Event JSON (chrome://tracing, ui.perfetto.dev)
+bool ExportTrace(const char* fileName);
+
+#endif
@@ -1,11 +1,23 @@
 #include "utils.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTILS_SSE2
+#endif
+
+void UpdateGraphTransform(Graph* graph) {
+    graph->scaleX = graph->bounds.width / (graph->xMax - graph->xMin);
+    graph->offsetX = graph->bounds.x - graph->xMin * graph->scaleX;
+    graph->scaleY = -graph->bounds.height / (graph->yMax - graph->yMin);
+    graph->offsetY = graph->bounds.y + graph->bounds.height - graph->yMin * graph->scaleY;
+}
+
 int WorldToScreenX(Graph* graph, float x) {
-    return graph->bounds.x + ((x - graph->xMin) / (graph->xMax - graph->xMin)) * graph->bounds.width;
+    return (int)(x * graph->scaleX + graph->offsetX);
 }
 
 int WorldToScreenY(Graph* graph, float y) {
-    return graph->bounds.y + graph->bounds.height - ((y - graph->yMin) / (graph->yMax - graph->yMin)) * graph->bounds.height;
+    return (int)(y * graph->scaleY + graph->offsetY);
 }
 
 float ScreenToWorldX(Graph* graph, int x) {
@@ -15,3 +27,32 @@ float ScreenToWorldX(Graph* graph, int x) {
 float ScreenToWorldY(Graph* graph, int y) {
     return graph->yMin + (1.0f - (float)(y - graph->bounds.y) / graph->bounds.height) * (graph->yMax - graph->yMin);
 }
+
+void TransformSamples(const Graph* graph, const float* samples, int first, int count, float x0, float step,
+    float* screenX, float* screenY) {
+    int i = 0;
+
+#ifdef UTILS_SSE2
+    __m128 origin = _mm_set1_ps(x0);
+    __m128 xStep = _mm_set1_ps(step);
+    __m128 scaleX = _mm_set1_ps(graph->scaleX);
+    __m128 offsetX = _mm_set1_ps(graph->offsetX);
+    __m128 scaleY = _mm_set1_ps(graph->scaleY);
+    __m128 offsetY = _mm_set1_ps(graph->offsetY);
+    __m128i index = _mm_add_epi32(_mm_set1_epi32(first), _mm_setr_epi32(0, 1, 2, 3));
+    __m128i four = _mm_set1_epi32(4);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_add_ps(origin, _mm_mul_ps(_mm_cvtepi32_ps(index), xStep));
+        _mm_storeu_ps(screenX + i, _mm_add_ps(_mm_mul_ps(x, scaleX), offsetX));
+        _mm_storeu_ps(screenY + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(samples + i), scaleY), offsetY));
+        index = _mm_add_epi32(index, four);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float x = x0 + (first + i) * step;
+        screenX[i] = x * graph->scaleX + graph->offsetX;
+        screenY[i] = samples[i] * graph->scaleY + graph->offsetY;
+    }
+}
@@ -4,9 +4,15 @@
 #include "raylib.h"
 #include "graph.h"
 
+#define TRANSFORM_CHUNK 256
+
+void UpdateGraphTransform(Graph* graph);
 int WorldToScreenX(Graph* graph, float x);
 int WorldToScreenY(Graph* graph, float y);
 float ScreenToWorldX(Graph* graph, int x);
 float ScreenToWorldY(Graph* graph, int y);
+// Screen positions of samples[0..count) taken at x = x0 + (first + i) * step
+void TransformSamples(const Graph* graph, const float* samples, int first, int count, float x0, float step,
+    float* screenX, float* screenY);
 
 #endif